@@ -3,18 +3,59 @@
 
 #include <jni.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cassert>
+#include <atomic>
 #include <mutex>
 #include <memory>
+#include <list>
+#include <shared_mutex>
+#include <string>
 #include <string_view>
 #include <functional>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <future>
+#include <latch>
+#include <ranges>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <stdexcept>
 #include <span>
 #include <optional>
+#include <unordered_map>
+#include <limits>
 #include <utility>
+#include <vector>
 #include <cstdint>
+#include <cstdlib>
+#include <exception>
+
+#if __has_include(<expected>)
+#   include <expected>
+#endif
+
+// SIMD backend for jb::algo (define JBRIDGE_ALGO_SCALAR to force the scalar fallback)
+#if !defined(JBRIDGE_ALGO_SCALAR)
+#   if defined(__AVX2__)
+#       include <immintrin.h>
+#       define JBRIDGE_ALGO_AVX2 1
+#   elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       include <emmintrin.h>
+#       if defined(__SSE4_1__)
+#           include <smmintrin.h>
+#       endif
+#       define JBRIDGE_ALGO_SSE2 1
+#   elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#       include <arm_neon.h>
+#       define JBRIDGE_ALGO_NEON 1
+#   endif
+#endif
 
 namespace jb {
 
@@ -22,14 +63,42 @@ namespace jb {
     // Forward Declarations
     // ============================================================================
 
+    namespace traits {
+
+        template<typename T>
+        struct primitive_array;
+
+    }
+
+    // ============================================================================
+    // Threading Policies (array wrappers)
+    // ============================================================================
+
+    // Default: the wrapper is confined to one thread and locking compiles away
+    struct Unsynchronized {
+        struct mutex_type {
+            constexpr void lock() noexcept {}
+            constexpr void unlock() noexcept {}
+        };
+    };
+
+    // Opt-in: element access is serialized through a std::mutex. A shared wrapper cannot be
+    // reassigned, so its size is fixed and Size() never locks.
+    struct Synchronized {
+        using mutex_type = std::mutex;
+    };
+
     namespace detail {
 
-        template<typename JArrayType, typename ElementType>
+        template<typename JArrayType, typename ElementType, typename ThreadingPolicy = Unsynchronized>
         class JPrimitiveArray;
 
-        template<typename MirrorClass>
+        template<typename MirrorClass, typename ThreadingPolicy = Unsynchronized>
         class JObjectArray;
 
+        template<typename ElementType>
+        class JDirectBuffer;
+
         template<typename MirrorType>
         class BaseClass;
 
@@ -40,9 +109,23 @@ namespace jb {
 
             [[nodiscard]] inline auto GetEnv() noexcept -> JNIEnv*;
 
+            inline void CheckException(JNIEnv* env);
+
+            [[noreturn]] inline void RaisePendingException(JNIEnv* env);
+
         }
     }
 
+    // Modified: JNI's modified UTF-8 (GetStringUTFRegion). Standard: transcoded from UTF-16.
+    enum class Utf8Mode {
+        Modified,
+        Standard,
+    };
+
+    [[nodiscard]] inline auto ToStdString(jstring str, 
+                                          Utf8Mode mode = Utf8Mode::Modified, 
+                                          JNIEnv* env = detail::jni::GetEnv()) -> std::string;
+
     // ============================================================================
     // Compile-time String Utilities (C++20 consteval)
     // ============================================================================
@@ -274,6 +357,19 @@ namespace jb {
             requires HasClassSignature<T>
         inline constexpr auto class_signature_v = class_signature<T>();
 
+        // Mirror of java.lang.String
+        template<typename T>
+        consteval auto is_java_string() -> bool {
+            if constexpr (HasClassSignature<T>) {
+                return std::string_view{class_signature_v<T>.data()} == "java/lang/String";
+            } else {
+                return false;
+            }
+        }
+
+        template<typename T>
+        inline constexpr bool is_java_string_v = is_java_string<T>();
+
     } // namespace traits
 
     // ============================================================================
@@ -336,6 +432,8 @@ namespace jb {
     template<typename Mirror>
     class ObjectRef {
     public:
+        using mirror_type = Mirror;
+
         constexpr ObjectRef() noexcept = default;
         
         explicit ObjectRef(jobject obj) noexcept : obj_(obj) {}
@@ -379,8 +477,20 @@ namespace jb {
     using FloatArray    = detail::JPrimitiveArray<jfloatArray, jfloat>;
     using DoubleArray   = detail::JPrimitiveArray<jdoubleArray, jdouble>;
 
-    template<typename MirrorClass>
-    using ObjectArray   = detail::JObjectArray<MirrorClass>;
+    // Released with JNI_ABORT: reads never pay for a copy-back
+    template<typename ElementType, typename ThreadingPolicy = Unsynchronized>
+    using ReadOnlyArray = detail::JPrimitiveArray<typename traits::primitive_array<ElementType>::type, 
+                                                  const ElementType, ThreadingPolicy>;
+
+    template<typename ElementType>
+    using SynchronizedArray = detail::JPrimitiveArray<typename traits::primitive_array<ElementType>::type, 
+                                                      ElementType, Synchronized>;
+
+    template<typename MirrorClass, typename ThreadingPolicy = Unsynchronized>
+    using ObjectArray   = detail::JObjectArray<MirrorClass, ThreadingPolicy>;
+
+    template<typename ElementType = jbyte>
+    using DirectBuffer  = detail::JDirectBuffer<ElementType>;
 
     template<typename Tp>
     using JniObject     = detail::jni::JniObject<Tp>;
@@ -534,6 +644,11 @@ namespace jb {
             static constexpr auto SIGNATURE = str::arrayify("[D");
         };
 
+        // Read-only arrays share the signature of their mutable counterpart
+        template<typename T>
+            requires requires { signature<T[]>::SIGNATURE; }
+        struct signature<const T[], true, false> : signature<T[]> {};
+
         // String signatures
         template<std::size_t N> struct signature<const char (&)[N], false, false> {
             static constexpr auto SIGNATURE = str::arrayify("Ljava/lang/String;");
@@ -557,6 +672,10 @@ namespace jb {
             static constexpr auto SIGNATURE = str::arrayify("Ljava/lang/String;");
         };
 
+        template<typename ElementType> struct signature<detail::JDirectBuffer<ElementType>, false, false> {
+            static constexpr auto SIGNATURE = str::arrayify("Ljava/nio/ByteBuffer;");
+        };
+
         // ========================================================================
         // JNI Field Access Traits (using concepts)
         // ========================================================================
@@ -580,11 +699,14 @@ namespace jb {
         template<concepts::DerivedFromJBase Type>
         struct jni_field<Type, true> {
             [[nodiscard]] static auto access(JNIEnv* env, jfieldID field_id, jclass cls) -> Type {
-                return Type(env->GetStaticObjectField(cls, field_id));
+                auto value = env->GetStaticObjectField(cls, field_id);
+                detail::jni::CheckException(env);
+                return Type(value);
             }
 
             static void set(JNIEnv* env, jfieldID field_id, jclass cls, jobject value) {
                 env->SetStaticObjectField(cls, field_id, value);
+                detail::jni::CheckException(env);
             }
         };
 
@@ -600,10 +722,13 @@ namespace jb {
             }; \
             template<> struct jni_field<jtype, true> { \
                 [[nodiscard]] static auto access(JNIEnv* env, jfieldID field_id, jclass cls) -> jtype { \
-                    return env->JniStaticGetMethod(cls, field_id); \
+                    auto value = env->JniStaticGetMethod(cls, field_id); \
+                    detail::jni::CheckException(env); \
+                    return value; \
                 } \
                 static void set(JNIEnv* env, jfieldID field_id, jclass cls, jtype value) { \
                     env->JniStaticSetMethod(cls, field_id, value); \
+                    detail::jni::CheckException(env); \
                 } \
             };
 
@@ -629,13 +754,17 @@ namespace jb {
             template<> struct jni_call<jtype, false> { \
                 template<typename ...Args> \
                 [[nodiscard]] static auto call(JNIEnv* env, jmethodID method_id, jobject instance, Args&&... args) -> jtype { \
-                    return env->JniMethod(instance, method_id, std::forward<Args>(args)...); \
+                    auto result = env->JniMethod(instance, method_id, std::forward<Args>(args)...); \
+                    detail::jni::CheckException(env); \
+                    return result; \
                 } \
             }; \
             template<> struct jni_call<jtype, true> { \
                 template<typename ...Args> \
                 [[nodiscard]] static auto call(JNIEnv* env, jmethodID method_id, jclass cls, Args&&... args) -> jtype { \
-                    return env->JniStaticMethod(cls, method_id, std::forward<Args>(args)...); \
+                    auto result = env->JniStaticMethod(cls, method_id, std::forward<Args>(args)...); \
+                    detail::jni::CheckException(env); \
+                    return result; \
                 } \
             };
 
@@ -686,6 +815,7 @@ namespace jb {
             template<typename ...Args>
             static void call(JNIEnv* env, jmethodID method_id, jobject instance, Args&&... args) {
                 env->CallVoidMethod(instance, method_id, std::forward<Args>(args)...);
+                detail::jni::CheckException(env);
             }
         };
 
@@ -693,6 +823,7 @@ namespace jb {
             template<typename ...Args>
             static void call(JNIEnv* env, jmethodID method_id, jclass cls, Args&&... args) {
                 env->CallStaticVoidMethod(cls, method_id, std::forward<Args>(args)...);
+                detail::jni::CheckException(env);
             }
         };
 
@@ -747,6 +878,32 @@ namespace jb {
 
         #undef JBRIDGE_DEFINE_PRIMITIVE_WRAP
 
+        // ========================================================================
+        // Primitive Array Traits (element type -> j<primitive>Array)
+        // ========================================================================
+
+        template<typename T>
+        struct primitive_array;
+
+        #define JBRIDGE_DEFINE_PRIMITIVE_ARRAY(element, array) \
+            template<> struct primitive_array<element> { \
+                using type = array; \
+            };
+
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jboolean, jbooleanArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jbyte,    jbyteArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jchar,    jcharArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jshort,   jshortArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jint,     jintArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jlong,    jlongArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jfloat,   jfloatArray)
+        JBRIDGE_DEFINE_PRIMITIVE_ARRAY(jdouble,  jdoubleArray)
+
+        #undef JBRIDGE_DEFINE_PRIMITIVE_ARRAY
+
+        template<typename T>
+        using primitive_array_t = typename primitive_array<T>::type;
+
         // ========================================================================
         // FQCN Generation (uses class_signature_v for cyclic reference support)
         // ========================================================================
@@ -768,15 +925,24 @@ namespace jb {
         template<typename T>
         struct is_array_wrapper : std::false_type {};
 
-        template<typename Mirror>
-        struct is_array_wrapper<ObjectArray<Mirror>> : std::true_type {};
+        template<typename Mirror, typename ThreadingPolicy>
+        struct is_array_wrapper<ObjectArray<Mirror, ThreadingPolicy>> : std::true_type {};
 
-        template<typename ArrayType, typename ElementType>
-        struct is_array_wrapper<detail::JPrimitiveArray<ArrayType, ElementType>> : std::true_type {};
+        template<typename ArrayType, typename ElementType, typename ThreadingPolicy>
+        struct is_array_wrapper<detail::JPrimitiveArray<ArrayType, ElementType, ThreadingPolicy>> : std::true_type {};
 
         template<class Class>
         inline constexpr bool is_array_wrapper_v = is_array_wrapper<Class>::value;
 
+        template<typename T>
+        struct is_direct_buffer : std::false_type {};
+
+        template<typename ElementType>
+        struct is_direct_buffer<detail::JDirectBuffer<ElementType>> : std::true_type {};
+
+        template<class Class>
+        inline constexpr bool is_direct_buffer_v = is_direct_buffer<Class>::value;
+
         // ========================================================================
         // Type Validation
         // ========================================================================
@@ -804,14 +970,23 @@ namespace jb {
         template<> struct type_validfy<jfloat[], false, true>   { using type = jfloatArray; };
         template<> struct type_validfy<jdouble[], false, true>  { using type = jdoubleArray; };
 
+        template<typename T>
+            requires requires { typename type_validfy<T[]>::type; }
+        struct type_validfy<const T[], false, true> : type_validfy<T[]> {};
+
         // Mirror array -> ArrayType (wrapper), then double type_validfy resolves to jobject
         template<typename T>
         struct type_validfy<T, true, true> {
             using type = typename std::remove_extent_t<T>::ArrayType;
         };
 
-        template<typename Mirror>
-        struct type_validfy<ObjectArray<Mirror>, false, false> {
+        template<typename Mirror, typename ThreadingPolicy>
+        struct type_validfy<ObjectArray<Mirror, ThreadingPolicy>, false, false> {
+            using type = jobject;
+        };
+
+        template<typename ElementType>
+        struct type_validfy<detail::JDirectBuffer<ElementType>, false, false> {
             using type = jobject;
         };
 
@@ -844,6 +1019,20 @@ namespace jb {
         template<> struct array_wrapper<jfloat[]>    { using type = FloatArray; };
         template<> struct array_wrapper<jdouble[]>   { using type = DoubleArray; };
 
+        // const T[] -> read-only wrapper
+        template<typename T>
+        struct read_only_array;
+
+        template<typename ArrayType, typename ElementType, typename ThreadingPolicy>
+        struct read_only_array<detail::JPrimitiveArray<ArrayType, ElementType, ThreadingPolicy>> {
+            using type = detail::JPrimitiveArray<ArrayType, const ElementType, ThreadingPolicy>;
+        };
+
+        template<typename T>
+        struct array_wrapper<const T[], false, true> {
+            using type = typename read_only_array<typename array_wrapper<T[]>::type>::type;
+        };
+
         template<typename T>
         using array_wrapper_t = typename array_wrapper<T>::type;
 
@@ -924,21 +1113,84 @@ namespace jb {
 
             inline static JavaVM* vm_ = nullptr;
 
-            [[nodiscard]] inline auto GetEnv() noexcept -> JNIEnv* {
-                struct Attacher {
-                    explicit Attacher() {
-                        vm_->AttachCurrentThread(reinterpret_cast<void**>(&env_), nullptr);
-                    }
+#ifndef NDEBUG
+            // Number of CriticalView scopes alive on this thread
+            inline thread_local int critical_depth_ = 0;
+#endif
+
+            inline void EnterCritical() noexcept {
+#ifndef NDEBUG
+                ++critical_depth_;
+#endif
+            }
+
+            inline void LeaveCritical() noexcept {
+#ifndef NDEBUG
+                --critical_depth_;
+#endif
+            }
+
+            inline constexpr jint kJniVersion = JNI_VERSION_1_6;
 
-                    ~Attacher() {
+            // Constant-initialized, so the fast path reads it without a thread_local init guard
+            inline thread_local JNIEnv* thread_env_ = nullptr;
+
+            struct AttachOptions {
+                bool daemon = false;
+                const char* name = nullptr;
+            };
+
+            // Detaches on thread exit, but only threads JBridge attached itself.
+            // Only touched on the attach path.
+            struct ThreadAttachment {
+                bool owned = false;
+
+                ~ThreadAttachment() {
+                    if (owned && vm_) {
                         vm_->DetachCurrentThread();
                     }
+                    thread_env_ = nullptr;
+                }
+            };
 
-                    JNIEnv* env_{};
-                };
+            inline thread_local ThreadAttachment attachment_;
+
+            [[nodiscard]] inline auto AttachThread(AttachOptions const& options) noexcept -> JNIEnv* {
+                JNIEnv* env = nullptr;
 
-                thread_local Attacher attacher;
-                return attacher.env_;
+                // Already attached (VM-created thread, or attached by other native code): never ours to detach
+                if (vm_->GetEnv(reinterpret_cast<void**>(&env), kJniVersion) == JNI_OK) {
+                    return thread_env_ = env;
+                }
+
+                JavaVMAttachArgs args{kJniVersion, const_cast<char*>(options.name), nullptr};
+                auto result = options.daemon 
+                    ? vm_->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), &args)
+                    : vm_->AttachCurrentThread(reinterpret_cast<void**>(&env), &args);
+                if (result != JNI_OK) {
+                    return nullptr;
+                }
+
+                attachment_.owned = true;
+                return thread_env_ = env;
+            }
+
+            [[nodiscard]] inline auto GetEnv() noexcept -> JNIEnv* {
+                assert(critical_depth_ == 0 && "JNI call while a CriticalView is alive");
+
+                if (auto env = thread_env_) [[likely]] {
+                    return env;
+                }
+                return AttachThread({});
+            }
+
+            // GetEnv() without the CriticalView assert: nested critical regions are legal,
+            // and inside one the env is already cached by the enclosing view
+            [[nodiscard]] inline auto GetCriticalEnv() noexcept -> JNIEnv* {
+                if (auto env = thread_env_) [[likely]] {
+                    return env;
+                }
+                return AttachThread({});
             }
 
             [[nodiscard]] inline auto GetDefaultConstructor(JNIEnv* env, jclass cls) -> jmethodID {
@@ -967,13 +1219,145 @@ namespace jb {
                 return GetEnv()->FindClass(class_signature.data());
             }
 
-            // FindClass for mirror types using trait
+            // Process-wide class cache keyed by signature.
+            // Resolved once, held as a global ref and read without locking afterwards.
+            template<auto ClassSignature>
+            [[nodiscard]] inline auto FindCachedClass() -> jclass {
+                static std::atomic<jclass> cache{nullptr};
+
+                if (auto cls = cache.load(std::memory_order_acquire))
+                    return cls;
+
+                auto env = GetEnv();
+                auto local = env->FindClass(ClassSignature.data());
+                if (!local)
+                    return nullptr;
+
+                auto global = MakeGlobalRef<jclass>(env, local);
+                env->DeleteLocalRef(local);
+
+                jclass expected = nullptr;
+                if (!cache.compare_exchange_strong(expected, global, std::memory_order_acq_rel)) {
+                    // Another thread won the race; keep its ref
+                    env->DeleteGlobalRef(global);
+                    return expected;
+                }
+                return global;
+            }
+
+            // FindClass for mirror types using trait (cached)
             template<concepts::MirrorClass Mirror>
             [[nodiscard]] inline auto FindClassFor() -> jclass {
-                return GetEnv()->FindClass(traits::class_signature_v<Mirror>.data());
+                return FindCachedClass<traits::class_signature_v<Mirror>>();
+            }
+
+            // ====================================================================
+            // TemporaryRef: Local ref owned by a single call expression
+            // ====================================================================
+
+            template<concepts::JniObjectType Tp>
+            class TemporaryRef {
+            public:
+                TemporaryRef(JNIEnv* env, Tp ref) noexcept : env_(env), ref_(ref) {}
+
+                // Borrows a ref owned elsewhere (e.g. an interned global ref); never deleted
+                explicit TemporaryRef(Tp borrowed) noexcept : env_(nullptr), ref_(borrowed) {}
+
+                TemporaryRef(TemporaryRef const&) = delete;
+                TemporaryRef& operator=(TemporaryRef const&) = delete;
+
+                TemporaryRef(TemporaryRef&& o) noexcept 
+                    : env_(o.env_)
+                    , ref_(std::exchange(o.ref_, nullptr)) 
+                {}
+
+                TemporaryRef& operator=(TemporaryRef&&) = delete;
+
+                ~TemporaryRef() {
+                    if (env_ && ref_) {
+                        env_->DeleteLocalRef(ref_);
+                    }
+                }
+
+                [[nodiscard]] auto Get() const noexcept -> Tp {
+                    return ref_;
+                }
+
+            private:
+                JNIEnv* env_;
+                Tp ref_;
+            };
+
+            template<typename T>
+            struct is_temporary_ref : std::false_type {};
+
+            template<typename Tp>
+            struct is_temporary_ref<TemporaryRef<Tp>> : std::true_type {};
+
+            // ====================================================================
+            // Interned Literals: One global-ref String per char array argument
+            // ====================================================================
+
+            // Upper bound on interned literals; arrays beyond it fall back to NewStringUTF
+            inline constexpr std::size_t kMaxInternedLiterals = 4096;
+
+            // Slots in each thread's direct-mapped front cache (a power of two)
+            inline constexpr std::size_t kInternFrontSlots = 64;
+
+            struct InternedLiteral {
+                std::string text;
+                jstring string;
+            };
+
+            // Keyed by the array's address and verified against its contents,
+            // so a reused non-literal char buffer is never served a stale String.
+            // Hits are served from a thread_local front cache without locking; the shared map
+            // is only consulted on a miss. Entries are never erased, so cached pointers stay valid.
+            // Returns nullptr when the array cannot be interned.
+            [[nodiscard]] inline auto InternLiteral(JNIEnv* env, const char* literal, std::size_t length) -> jstring {
+                static std::shared_mutex mutex;
+                static std::unordered_map<const char*, InternedLiteral> interned;
+
+                thread_local std::array<std::pair<const char*, InternedLiteral const*>, kInternFrontSlots> front{};
+
+                std::string_view text{literal, length};
+                auto& slot = front[reinterpret_cast<std::uintptr_t>(literal) % kInternFrontSlots];
+                if (slot.first == literal)
+                    return slot.second->text == text ? slot.second->string : nullptr;
+
+                auto serve = [&](InternedLiteral const& entry) -> jstring {
+                    if (entry.text != text)
+                        return nullptr;
+                    slot = {literal, &entry};
+                    return entry.string;
+                };
+
+                {
+                    std::shared_lock lock(mutex);
+                    if (auto it = interned.find(literal); it != interned.end())
+                        return serve(it->second);
+                    if (interned.size() >= kMaxInternedLiterals)
+                        return nullptr;
+                }
+
+                auto local = env->NewStringUTF(literal);
+                if (!local)
+                    return nullptr;
+
+                auto global = MakeGlobalRef<jstring>(env, local);
+                env->DeleteLocalRef(local);
+
+                std::unique_lock lock(mutex);
+                auto [it, inserted] = interned.try_emplace(literal, InternedLiteral{std::string(text), global});
+                if (!inserted) {
+                    // Another thread interned it first; keep its ref
+                    env->DeleteGlobalRef(global);
+                }
+                return serve(it->second);
             }
 
             // Validfy: Convert C++ types to JNI-compatible types
+            // Refs created here are returned as TemporaryRef and must be passed through Unwrap
             template<typename T>
             [[nodiscard]] inline auto Validfy(T&& t) {
                 using ArgType = std::remove_cvref_t<T>;
@@ -985,10 +1369,28 @@ namespace jb {
                 } else if constexpr (concepts::DerivedFromJBase<ArgType>) {
                     return t.GetObject();
                 } else if constexpr (concepts::StringLike<ArgType>) {
-                    return GetEnv()->NewStringUTF(t.data());
+                    auto env = GetEnv();
+                    if constexpr (std::same_as<ArgType, std::string>) {
+                        return TemporaryRef<jstring>{env, env->NewStringUTF(t.c_str())};
+                    } else {
+                        // string_view is not guaranteed to be null-terminated
+                        return TemporaryRef<jstring>{env, env->NewStringUTF(std::string(t).c_str())};
+                    }
                 } else if constexpr (traits::is_const_chars_ref_v<T>) {
-                    return GetEnv()->NewStringUTF(t);
-                } else if constexpr (traits::is_array_wrapper_v<ArgType>) {
+                    auto env = GetEnv();
+                    constexpr auto length = std::extent_v<std::remove_reference_t<T>> - 1;
+                    if (auto interned = InternLiteral(env, t, length))
+                        return TemporaryRef<jstring>{interned};
+                    return TemporaryRef<jstring>{env, env->NewStringUTF(t)};
+                } else if constexpr (is_temporary_ref<ArgType>::value) {
+                    // e.g. StringCache lookups: an rvalue hands its ref to the call expression,
+                    // a named ref is only borrowed and stays usable for later calls
+                    if constexpr (std::is_lvalue_reference_v<T>) {
+                        return ArgType{t.Get()};
+                    } else {
+                        return ArgType{std::move(t)};
+                    }
+                } else if constexpr (traits::is_array_wrapper_v<ArgType> || traits::is_direct_buffer_v<ArgType>) {
                     return t.Raw();
                 } else if constexpr (std::is_same_v<ArgType, ObjectRef<typename ArgType::value_type>> || 
                                      requires { typename ArgType::value_type; static_cast<jobject>(t); }) {
@@ -999,26 +1401,118 @@ namespace jb {
                 }
             }
 
+            // Unwrap: Extract the JNI value from a Validfy result.
+            // A TemporaryRef lives until the end of the caller's full-expression, 
+            // so its local ref is deleted right after the Call*Method returns.
+            template<typename T>
+            [[nodiscard]] inline auto Unwrap(T&& t) {
+                if constexpr (is_temporary_ref<std::remove_cvref_t<T>>::value) {
+                    return t.Get();
+                } else {
+                    return t;
+                }
+            }
+
+            // ====================================================================
+            // Boxing: Cached wrapper classes, valueOf IDs and small boxed values
+            // ====================================================================
+
+            // bool/char box through their JNI counterparts
+            template<typename T>
+            using box_value_t = std::conditional_t<std::same_as<T, bool>, jboolean,
+                                std::conditional_t<std::same_as<T, char>, jchar, T>>;
+
+            template<concepts::JniPrimitive T>
+            [[nodiscard]] constexpr auto ToBoxValue(T value) noexcept -> box_value_t<T> {
+                if constexpr (std::same_as<T, char>) {
+                    return static_cast<jchar>(static_cast<unsigned char>(value));
+                } else {
+                    return static_cast<box_value_t<T>>(value);
+                }
+            }
+
+            template<concepts::JniPrimitive T>
+            [[nodiscard]] inline auto BoxClass() -> jclass {
+                return FindCachedClass<traits::primitive_wrap<T>::WRAPPER_SIGNATURE>();
+            }
+
+            template<concepts::JniPrimitive T>
+            [[nodiscard]] inline auto BoxMethod() -> jmethodID {
+                using TWrapped = traits::primitive_wrap<T>;
+                static const auto methodid_value = GetEnv()->GetStaticMethodID(
+                    BoxClass<T>(), "valueOf",
+                    str::add_all(
+                        str::arrayify("("),
+                        traits::signature<T>::SIGNATURE,
+                        str::arrayify(")"),
+                        to_fqcn<false>(TWrapped::WRAPPER_SIGNATURE)
+                    ).data()
+                );
+                return methodid_value;
+            }
+
+            // Slot in the small-value cache, or -1 if the value is boxed per call.
+            // Covers the same values the JDK's own valueOf caches (booleans, -128..127, chars 0..127).
+            template<typename T>
+            [[nodiscard]] constexpr auto BoxSlot(T value) noexcept -> std::ptrdiff_t {
+                if constexpr (std::floating_point<T>) {
+                    return -1;
+                } else if constexpr (std::unsigned_integral<T>) {
+                    return value < 128 ? static_cast<std::ptrdiff_t>(value) : -1;
+                } else {
+                    return (value >= -128 && value <= 127) ? static_cast<std::ptrdiff_t>(value) + 128 : -1;
+                }
+            }
+
+            // Global ref to the cached boxed value, or nullptr if it is not cacheable
+            template<typename T>
+            [[nodiscard]] inline auto BoxCached(JNIEnv* env, T value) -> jobject {
+                static std::array<std::atomic<jobject>, 256> cache{};
+
+                auto slot = BoxSlot(value);
+                if (slot < 0)
+                    return nullptr;
+
+                auto& entry = cache[static_cast<std::size_t>(slot)];
+                if (auto boxed = entry.load(std::memory_order_acquire))
+                    return boxed;
+
+                auto local = env->CallStaticObjectMethod(BoxClass<T>(), BoxMethod<T>(), value);
+                if (!local)
+                    return nullptr;
+
+                auto global = MakeGlobalRef<jobject>(env, local);
+                env->DeleteLocalRef(local);
+
+                jobject expected = nullptr;
+                if (!entry.compare_exchange_strong(expected, global, std::memory_order_acq_rel)) {
+                    env->DeleteGlobalRef(global);
+                    return expected;
+                }
+                return global;
+            }
+
+            // Box: Returns a new local ref to the boxed value
+            template<concepts::JniPrimitive T>
+            [[nodiscard]] inline auto Box(JNIEnv* env, T t) -> jobject {
+                auto value = ToBoxValue(t);
+                using V = decltype(value);
+
+                if (auto boxed = BoxCached(env, value))
+                    return env->NewLocalRef(boxed);
+                return env->CallStaticObjectMethod(BoxClass<V>(), BoxMethod<V>(), value);
+            }
+
             // JObjectify: Convert to boxed Java object
             template<typename T>
             [[nodiscard]] inline auto JObjectify(T&& t) -> jobject {
-                if constexpr (concepts::JniPrimitive<T>) {
-                    using TWrapped = traits::primitive_wrap<T>;
-                    auto env = GetEnv();
-                    auto cls = env->FindClass(TWrapped::WRAPPER_SIGNATURE.data());
-                    static auto methodid_value = env->GetStaticMethodID(
-                        cls, "valueOf",
-                        str::add_all(
-                            str::arrayify("("),
-                            traits::signature<T>::SIGNATURE,
-                            str::arrayify(")"),
-                            to_fqcn<false>(TWrapped::WRAPPER_SIGNATURE)
-                        ).data()
-                    );
-                    return env->CallStaticObjectMethod(cls, methodid_value, t);
-                } else if constexpr (concepts::DerivedFromJBase<T>) {
+                using ArgType = std::remove_cvref_t<T>;
+
+                if constexpr (concepts::JniPrimitive<ArgType>) {
+                    return Box(GetEnv(), t);
+                } else if constexpr (concepts::DerivedFromJBase<ArgType>) {
                     return t.GetObject();
-                } else if constexpr (concepts::JniObjectType<T>) {
+                } else if constexpr (concepts::JniObjectType<ArgType>) {
                     return t;
                 } else {
                     static_assert(traits::deferred_false<T>::value, "Cannot convert type to jobject");
@@ -1055,46 +1549,46 @@ namespace jb {
             }
 
             template<concepts::JniArrayType JArrayType>
-            [[nodiscard]] auto GetArrayElements(JNIEnv* env, JArrayType array) {
+            [[nodiscard]] auto GetArrayElements(JNIEnv* env, JArrayType array, jboolean* is_copy = nullptr) {
                 if constexpr (std::same_as<JArrayType, jbooleanArray>) {
-                    return env->GetBooleanArrayElements(array, nullptr);
+                    return env->GetBooleanArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jbyteArray>) {
-                    return env->GetByteArrayElements(array, nullptr);
+                    return env->GetByteArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jcharArray>) {
-                    return env->GetCharArrayElements(array, nullptr);
+                    return env->GetCharArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jshortArray>) {
-                    return env->GetShortArrayElements(array, nullptr);
+                    return env->GetShortArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jintArray>) {
-                    return env->GetIntArrayElements(array, nullptr);
+                    return env->GetIntArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jlongArray>) {
-                    return env->GetLongArrayElements(array, nullptr);
+                    return env->GetLongArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jfloatArray>) {
-                    return env->GetFloatArrayElements(array, nullptr);
+                    return env->GetFloatArrayElements(array, is_copy);
                 } else if constexpr (std::same_as<JArrayType, jdoubleArray>) {
-                    return env->GetDoubleArrayElements(array, nullptr);
+                    return env->GetDoubleArrayElements(array, is_copy);
                 } else {
                     static_assert(traits::deferred_false<JArrayType>::value, "Unsupported JNI array type");
                 }
             }
 
             template<concepts::JniArrayType JArrayType, typename ElementType>
-            void ReleaseArrayRegion(JNIEnv* env, JArrayType array, ElementType* elements) {
+            void ReleaseArrayRegion(JNIEnv* env, JArrayType array, ElementType* elements, jint mode = 0) {
                 if constexpr (std::same_as<JArrayType, jbooleanArray>) {
-                    env->ReleaseBooleanArrayElements(array, elements, 0);
+                    env->ReleaseBooleanArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jbyteArray>) {
-                    env->ReleaseByteArrayElements(array, elements, 0);
+                    env->ReleaseByteArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jcharArray>) {
-                    env->ReleaseCharArrayElements(array, elements, 0);
+                    env->ReleaseCharArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jshortArray>) {
-                    env->ReleaseShortArrayElements(array, elements, 0);
+                    env->ReleaseShortArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jintArray>) {
-                    env->ReleaseIntArrayElements(array, elements, 0);
+                    env->ReleaseIntArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jlongArray>) {
-                    env->ReleaseLongArrayElements(array, elements, 0);
+                    env->ReleaseLongArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jfloatArray>) {
-                    env->ReleaseFloatArrayElements(array, elements, 0);
+                    env->ReleaseFloatArrayElements(array, elements, mode);
                 } else if constexpr (std::same_as<JArrayType, jdoubleArray>) {
-                    env->ReleaseDoubleArrayElements(array, elements, 0);
+                    env->ReleaseDoubleArrayElements(array, elements, mode);
                 } else {
                     static_assert(traits::deferred_false<JArrayType>::value, "Unsupported JNI array type");
                 }
@@ -1179,18 +1673,76 @@ namespace jb {
                 std::uintptr_t reference_;
             };
 
+            // ====================================================================
+            // GlobalFieldAccess: Member lists declared with JBRIDGE_GLOBAL_FIELDS
+            // ====================================================================
+
+            template<typename T>
+            struct is_jni_object : std::false_type {};
+
+            template<typename Tp>
+            struct is_jni_object<JniObject<Tp>> : std::true_type {};
+
+            template<typename T>
+            struct member_class;
+
+            template<typename M, typename C>
+            struct member_class<M C::*> {
+                using type = C;
+            };
+
+            // Befriended by JBRIDGE_GLOBAL_FIELDS so private member lists are reachable
+            struct GlobalFieldAccess {
+                // True when T's list covers all of T: T declares it itself, or inherits it (mirrors
+                // get BaseClass's) without adding data of its own. Otherwise T's own members would be
+                // missed, so the caller falls back to the tag scan.
+                template<typename T>
+                [[nodiscard]] static constexpr auto Declares() -> bool {
+                    if constexpr (requires { &T::jbridge_global_fields_; }) {
+                        using Owner = typename member_class<decltype(&T::jbridge_global_fields_)>::type;
+                        return std::same_as<Owner, T> || sizeof(T) == sizeof(Owner);
+                    } else {
+                        return false;
+                    }
+                }
+
+                // Applies fn(env, ref) to every listed JniObject / raw ref and writes the result back;
+                // nested types with their own list are visited recursively
+                template<typename T, typename Fn>
+                static void Visit(JNIEnv* env, T& field, Fn const& fn) {
+                    if constexpr (concepts::JniObjectType<T>) {
+                        if (field) {
+                            field = static_cast<T>(fn(env, field));
+                        }
+                    } else if constexpr (is_jni_object<T>::value) {
+                        if (field) {
+                            field.Set(static_cast<decltype(field.Get())>(fn(env, field.Get())));
+                        }
+                    } else if constexpr (Declares<T>()) {
+                        std::apply([env, &fn](auto&... members) {
+                            (Visit(env, members, fn), ...);
+                        }, field.jbridge_global_fields_());
+                    } else {
+                        static_assert(traits::deferred_false<T>::value, 
+                                      "JBRIDGE_GLOBAL_FIELDS: member is not a JniObject, JNI ref or listed type");
+                    }
+                }
+            };
+
             // ====================================================================
             // JniRef: Automatic global/local reference management
             // ====================================================================
 
+            // Types declaring JBRIDGE_GLOBAL_FIELDS, and mirrors without extra data, touch exactly the listed
+            // members. Anything else falls back to scanning each pointer-sized word for the kJniTag pattern.
             template<typename Tp>
             class JniRef {
                 static constexpr std::size_t FieldSize = sizeof(Tp);
                 static constexpr std::size_t PointerSize = sizeof(void*);
 
             private:
-                static void SearchJniObjectOnField(void* base, 
-                                                   std::function<void(JNIEnv*, std::uintptr_t&)> const& callback) {
+                template<typename Callback>
+                static void SearchJniObjectOnField(void* base, Callback const& callback) {
                     auto env = GetEnv();
                     auto start = reinterpret_cast<std::uintptr_t>(base);
                     for (std::size_t off = 0; off + PointerSize <= FieldSize; off += PointerSize) {
@@ -1203,24 +1755,47 @@ namespace jb {
 
             public:
                 static void Promote(Tp* base) {
-                    SearchJniObjectOnField(base, [](JNIEnv* env, std::uintptr_t& value) {
-                        if (IsEncoded(value)) {
+                    if constexpr (GlobalFieldAccess::Declares<Tp>()) {
+                        GlobalFieldAccess::Visit(GetEnv(), *base, [](JNIEnv* env, jobject ref) {
+                            return env->NewGlobalRef(ref);
+                        });
+                    } else {
+                        SearchJniObjectOnField(base, [](JNIEnv* env, std::uintptr_t& value) {
                             value = Encode(env->NewGlobalRef(Decode<jobject>(value)));
-                        }
-                    });
+                        });
+                    }
                 }
 
                 static void Demote(Tp* base) {
-                    SearchJniObjectOnField(base, [](JNIEnv* env, std::uintptr_t const& value) {
-                        if (IsEncoded(value)) {
+                    if constexpr (GlobalFieldAccess::Declares<Tp>()) {
+                        GlobalFieldAccess::Visit(GetEnv(), *base, [](JNIEnv* env, jobject ref) {
+                            env->DeleteGlobalRef(ref);
+                            return ref;
+                        });
+                    } else {
+                        SearchJniObjectOnField(base, [](JNIEnv* env, std::uintptr_t const& value) {
                             env->DeleteGlobalRef(Decode<jobject>(value));
-                        }
-                    });
+                        });
+                    }
                 }
             };
 
         } // namespace jni
 
+        // ID lookups used by mirrors and the member macros.
+        // A failed lookup leaves NoSuchMethodError/NoSuchFieldError pending. Raising it here, even inside
+        // an ExceptionScope, keeps a null ID out of the macros' function-local statics, so the next call retries.
+        template<typename IdType>
+        [[nodiscard]] auto CheckMemberId(IdType id, std::string_view name, JNIEnv* env) -> IdType {
+            if (id) [[likely]]
+                return id;
+
+            if (env->ExceptionCheck())
+                jni::RaisePendingException(env);
+
+            throw std::runtime_error(std::string("JBridge: member not found: ") + std::string(name));
+        }
+
         // ========================================================================
         // BaseClass: CRTP base for mirror classes
         // ========================================================================
@@ -1230,20 +1805,20 @@ namespace jb {
         public:
             using ArrayType = ObjectArray<MirrorType>;
 
-            explicit BaseClass() noexcept 
-                : env_(jni::GetEnv())
-                , declaring_class_(env_->FindClass(traits::class_signature_v<MirrorType>.data()))
-                , object_([this] {
-                    static jmethodID default_constructor = 
-                        env_->GetMethodID(declaring_class_.Get(), "<init>", "()V");
-                    return env_->NewObject(declaring_class_.Get(), default_constructor);
+            explicit BaseClass() 
+                : object_([] {
+                    auto env = jni::GetEnv();
+                    auto cls = jni::FindClassFor<MirrorType>();
+                    static jmethodID default_constructor = CheckMemberId(env->GetMethodID(cls, "<init>", "()V"), "<init>", env);
+                    auto object = env->NewObject(cls, default_constructor);
+                    jni::CheckException(env);
+                    return object;
                 }()) 
             {}
 
+            // Wraps the reference only: no JNIEnv lookup, no class lookup
             explicit BaseClass(jobject instance) noexcept 
-                : env_(jni::GetEnv())
-                , declaring_class_(env_->FindClass(traits::class_signature_v<MirrorType>.data()))
-                , object_(instance) 
+                : object_(instance) 
             {}
 
             BaseClass(BaseClass const& o) noexcept = default;
@@ -1251,17 +1826,31 @@ namespace jb {
             BaseClass& operator=(BaseClass const& o) noexcept = default;
             BaseClass& operator=(BaseClass&& o) noexcept = default;
 
-            [[nodiscard]] auto GetObject() -> jobject {
+            [[nodiscard]] auto GetObject() const noexcept -> jobject {
                 return object_.Get();
             }
 
-            [[nodiscard]] auto GetDeclaringClass() -> jclass {
-                return declaring_class_.Get();
+            // Served from the per-type class cache
+            [[nodiscard]] static auto GetDeclaringClass() -> jclass {
+                return jni::FindClassFor<MirrorType>();
+            }
+
+            // java.lang.String mirrors only
+            [[nodiscard]] auto str(Utf8Mode mode = Utf8Mode::Modified, JNIEnv* env = jni::GetEnv()) const -> std::string 
+                requires traits::is_java_string_v<MirrorType>
+            {
+                return ToStdString(static_cast<jstring>(object_.Get()), mode, env);
             }
 
         protected:
-            JNIEnv* env_{};
-            jni::JniObject<jclass> declaring_class_;
+            friend struct jni::GlobalFieldAccess;
+
+            // Member list for MakeGlobalRef (see JBRIDGE_GLOBAL_FIELDS)
+            [[nodiscard]] auto jbridge_global_fields_() noexcept {
+                return std::tie(object_);
+            }
+
+            // The only data member: mirrors are one word and trivially copyable
             jni::JniObject<jobject> object_;
         };
 
@@ -1276,10 +1865,13 @@ namespace jb {
 
             template<typename ...Args>
             [[nodiscard]] auto call(jclass cls, Args&&... args) -> jobject {
-                return jni::GetEnv()->NewObject(
+                auto env = jni::GetEnv();
+                auto object = env->NewObject(
                     cls, declaring_ctor_, 
-                    jni::Validfy(std::forward<Args>(args))...
+                    jni::Unwrap(jni::Validfy(std::forward<Args>(args)))...
                 );
+                jni::CheckException(env);
+                return object;
             }
 
         private:
@@ -1304,7 +1896,7 @@ namespace jb {
                 if constexpr (std::is_void_v<traits::type_validfy_t<ReturnType>>) {
                     traits::jni_call<traits::type_validfy_t<ReturnType>, true>::call(
                         jni::GetEnv(), declaring_method_, cls, 
-                        jni::Validfy(std::forward<Args>(args))...
+                        jni::Unwrap(jni::Validfy(std::forward<Args>(args)))...
                     );
                 } else {
                     // Double type_validfy_t: Mirror[] -> ArrayType -> jobject
@@ -1312,7 +1904,7 @@ namespace jb {
                         traits::type_validfy_t<traits::type_validfy_t<ReturnType>>, true
                     >::call(
                         jni::GetEnv(), declaring_method_, cls, 
-                        jni::Validfy(std::forward<Args>(args))...
+                        jni::Unwrap(jni::Validfy(std::forward<Args>(args)))...
                     );
                 }
             }
@@ -1325,7 +1917,7 @@ namespace jb {
                 if constexpr (std::is_void_v<traits::type_validfy_t<ReturnType>>) {
                     traits::jni_call<traits::type_validfy_t<ReturnType>, false>::call(
                         jni::GetEnv(), declaring_method_, object, 
-                        jni::Validfy(std::forward<Args>(args))...
+                        jni::Unwrap(jni::Validfy(std::forward<Args>(args)))...
                     );
                 } else {
                     // Double type_validfy_t: Mirror[] -> ArrayType -> jobject
@@ -1333,7 +1925,7 @@ namespace jb {
                         traits::type_validfy_t<traits::type_validfy_t<ReturnType>>, false
                     >::call(
                         jni::GetEnv(), declaring_method_, object, 
-                        jni::Validfy(std::forward<Args>(args))...
+                        jni::Unwrap(jni::Validfy(std::forward<Args>(args)))...
                     );
                 }
             }
@@ -1346,40 +1938,49 @@ namespace jb {
         // Factory Functions
         // ========================================================================
 
-        template<typename ...ArgsTypes, std::size_t N>
+        template<typename ...ArgsTypes>
         [[nodiscard]] static auto CreateConstructor(
-            std::array<char, N> const& class_signature,
+            jclass cls,
             JNIEnv* env = jni::GetEnv()
         ) -> Constructor {
             return Constructor{
-                env->GetMethodID(
-                    env->FindClass(class_signature.data()),
-                    "<init>",
-                    tokenizer::build_function_signature<void, std::remove_reference_t<ArgsTypes>...>().data()
+                CheckMemberId(
+                    env->GetMethodID(
+                        cls,
+                        "<init>",
+                        tokenizer::build_function_signature<void, std::remove_reference_t<ArgsTypes>...>().data()
+                    ),
+                    "<init>", env
                 )
             };
         }
 
-        template<bool IsStatic, typename ReturnType, typename ...ParameterTypes, std::size_t N>
+        template<bool IsStatic, typename ReturnType, typename ...ParameterTypes>
         [[nodiscard]] static auto CreateMethod(
-            std::array<char, N> const& class_signature,
+            jclass cls,
             std::string_view name,
             JNIEnv* env = jni::GetEnv()
         ) -> Method<ReturnType> {
             if constexpr (IsStatic) {
                 return Method<ReturnType>{
-                    env->GetStaticMethodID(
-                        env->FindClass(class_signature.data()),
-                        name.data(),
-                        tokenizer::build_function_signature<ReturnType, ParameterTypes...>().data()
+                    CheckMemberId(
+                        env->GetStaticMethodID(
+                            cls,
+                            name.data(),
+                            tokenizer::build_function_signature<ReturnType, ParameterTypes...>().data()
+                        ),
+                        name, env
                     )
                 };
             } else {
                 return Method<ReturnType>{
-                    env->GetMethodID(
-                        env->FindClass(class_signature.data()),
-                        name.data(),
-                        tokenizer::build_function_signature<ReturnType, ParameterTypes...>().data()
+                    CheckMemberId(
+                        env->GetMethodID(
+                            cls,
+                            name.data(),
+                            tokenizer::build_function_signature<ReturnType, ParameterTypes...>().data()
+                        ),
+                        name, env
                     )
                 };
             }
@@ -1474,51 +2075,82 @@ namespace jb {
             jobject object_ref_{};
         };
 
-        template<bool IsStatic, typename Type, std::size_t N>
+        template<bool IsStatic, typename Type>
         [[nodiscard]] static auto CreateField(
-            std::array<char, N> const& class_signature, 
+            jclass cls, 
             std::string_view name, 
             JNIEnv* env = jni::GetEnv()
         ) -> Field<IsStatic, Type> {
             if constexpr (IsStatic) {
                 return Field<IsStatic, Type>{
-                    env->GetStaticFieldID(
-                        env->FindClass(class_signature.data()),
-                        name.data(),
-                        traits::fqcnify<Type>().data()
+                    CheckMemberId(
+                        env->GetStaticFieldID(
+                            cls,
+                            name.data(),
+                            traits::fqcnify<Type>().data()
+                        ),
+                        name, env
                     )
                 };
             } else {
                 return Field<IsStatic, Type>{
-                    env->GetFieldID(
-                        env->FindClass(class_signature.data()),
-                        name.data(),
-                        traits::fqcnify<Type>().data()
+                    CheckMemberId(
+                        env->GetFieldID(
+                            cls,
+                            name.data(),
+                            traits::fqcnify<Type>().data()
+                        ),
+                        name, env
                     )
                 };
             }
         }
 
+        // Value cached by JBRIDGE_DEFINE_CONSTANT: primitives as is, objects promoted
+        // to a global ref that lives as long as the process (like the class cache)
+        template<typename Type>
+        [[nodiscard]] auto MakeConstant(Type value, JNIEnv* env = jni::GetEnv()) -> Type {
+            if constexpr (concepts::DerivedFromJBase<Type>) {
+                auto local = value.GetObject();
+                if (!local)
+                    return value;
+
+                Type global{env->NewGlobalRef(local)};
+                env->DeleteLocalRef(local);
+                return global;
+            } else if constexpr (concepts::JniPrimitive<Type>) {
+                return value;
+            } else {
+                static_assert(traits::deferred_false<Type>::value, 
+                              "JBRIDGE_DEFINE_CONSTANT supports primitive and mirror class fields only");
+            }
+        }
+
         // ========================================================================
         // JPrimitiveArray: Wrapper for JNI primitive arrays
         // ========================================================================
 
-        template<typename JArrayType, typename ElementType>
+        template<typename JArrayType, typename ElementType, typename ThreadingPolicy>
         class JPrimitiveArray {
+            // A const ElementType makes a read-only array that is never copied back
+            static constexpr bool kReadOnly = std::is_const_v<ElementType>;
+
+            using Element = std::remove_const_t<ElementType>;
+
         public:
             JPrimitiveArray() = default;
 
             explicit JPrimitiveArray(std::size_t initial_capacity) 
                 : env_(jni::GetEnv())
-                , array_(jni::NewPrimitiveArray<ElementType>(env_, initial_capacity))
-                , elements_(jni::GetArrayElements(env_, array_.Get()))
+                , array_(jni::NewPrimitiveArray<Element>(env_, initial_capacity))
+                , elements_(jni::GetArrayElements(env_, array_.Get(), &is_copy_))
                 , size_(static_cast<std::size_t>(env_->GetArrayLength(array_.Get()))) 
             {}
 
             explicit JPrimitiveArray(JArrayType array) 
                 : env_(jni::GetEnv())
                 , array_(array)
-                , elements_(jni::GetArrayElements(env_, array))
+                , elements_(jni::GetArrayElements(env_, array, &is_copy_))
                 , size_(static_cast<std::size_t>(env_->GetArrayLength(array))) 
             {}
 
@@ -1527,18 +2159,12 @@ namespace jb {
 
             JPrimitiveArray(JPrimitiveArray const& o) 
                 : env_(jni::GetEnv())
-                , array_(jni::NewPrimitiveArray<ElementType>(env_, o.size_))
-                , elements_(jni::GetArrayElements(env_, array_.Get()))
+                , array_(CopyOf(env_, o))
+                , elements_(jni::GetArrayElements(env_, array_.Get(), &is_copy_))
                 , size_(o.size_) 
-            {
-                auto* other_elements = jni::GetArrayElements(env_, o.array_.Get());
-                for (std::size_t i = 0; i < size_; ++i) {
-                    elements_[i] = other_elements[i];
-                }
-                jni::ReleaseArrayRegion(env_, o.array_.Get(), other_elements);
-            }
+            {}
 
-            JPrimitiveArray& operator=(JPrimitiveArray const& o) {
+            JPrimitiveArray& operator=(JPrimitiveArray const& o) requires (!std::same_as<ThreadingPolicy, Synchronized>) {
                 if (this == &o)
                     return *this;
 
@@ -1547,17 +2173,10 @@ namespace jb {
                 Release();
 
                 env_ = jni::GetEnv();
-                array_ = jni::JniObject<JArrayType>{jni::NewPrimitiveArray<ElementType>(env_, o.size_)};
+                array_ = jni::JniObject<JArrayType>{CopyOf(env_, o)};
                 size_ = o.size_;
-                
-                auto* other_elements = jni::GetArrayElements(env_, o.array_.Get());
-                elements_ = jni::GetArrayElements(env_, array_.Get());
-
-                for (std::size_t i = 0; i < size_; ++i) {
-                    elements_[i] = other_elements[i];
-                }
-
-                jni::ReleaseArrayRegion(env_, o.array_.Get(), other_elements);
+                elements_ = jni::GetArrayElements(env_, array_.Get(), &is_copy_);
+                tracking_ = false;
 
                 return *this;
             }
@@ -1565,14 +2184,17 @@ namespace jb {
             JPrimitiveArray(JPrimitiveArray&& o) noexcept 
                 : env_(o.env_)
                 , array_(o.array_.Get())
+                , is_copy_(o.is_copy_)
                 , elements_(o.elements_)
                 , size_(o.size_) 
+                , tracking_(o.tracking_)
+                , dirty_(std::move(o.dirty_))
             {
                 o.elements_ = nullptr;
                 o.size_ = 0;
             }
 
-            JPrimitiveArray& operator=(JPrimitiveArray&& o) noexcept {
+            JPrimitiveArray& operator=(JPrimitiveArray&& o) noexcept requires (!std::same_as<ThreadingPolicy, Synchronized>) {
                 if (this == &o)
                     return *this;
 
@@ -1581,9 +2203,12 @@ namespace jb {
                 Release();
 
                 env_ = o.env_;
+                is_copy_ = o.is_copy_;
                 elements_ = o.elements_;
                 array_ = jni::JniObject<JArrayType>{o.array_.Get()};
                 size_ = o.size_;
+                tracking_ = o.tracking_;
+                dirty_ = std::move(o.dirty_);
 
                 o.elements_ = nullptr;
                 o.size_ = 0;
@@ -1596,15 +2221,16 @@ namespace jb {
             }
 
             [[nodiscard]] auto operator[](std::size_t index) -> ElementType& {
+                RecordWrite(index, 1);
                 return elements_[index];
             }
 
-            [[nodiscard]] auto operator[](std::size_t index) const -> ElementType {
+            [[nodiscard]] auto operator[](std::size_t index) const -> Element {
                 return elements_[index];
             }
 
             [[nodiscard("Element value should be used")]] 
-            auto Get(std::size_t index) -> ElementType {
+            auto Get(std::size_t index) -> Element {
                 std::scoped_lock lock(mutex_);
 
                 if (index >= size_)
@@ -1614,7 +2240,7 @@ namespace jb {
             }
 
             [[nodiscard("Element value should be used")]] 
-            auto Get(std::size_t index) const -> ElementType {
+            auto Get(std::size_t index) const -> Element {
                 std::scoped_lock lock(mutex_);
 
                 if (index >= size_)
@@ -1623,17 +2249,46 @@ namespace jb {
                 return elements_[index];
             }
 
-            void Set(std::size_t index, ElementType element) {
+            void Set(std::size_t index, Element element) requires (!kReadOnly) {
                 std::scoped_lock lock(mutex_);
 
                 if (index >= size_)
                     throw std::out_of_range("JPrimitiveArray::Set(): index out of bounds");
 
+                AddDirty(index, 1);
                 elements_[index] = element;
             }
 
-            [[nodiscard]] auto Size() const -> std::size_t {
+            // Only copy modified regions back on release; untouched arrays are released with JNI_ABORT.
+            // Call before writing: earlier writes are not recorded.
+            void TrackWrites() requires (!kReadOnly) {
+                std::scoped_lock lock(mutex_);
+                tracking_ = true;
+            }
+
+            void MarkDirty(std::size_t offset, std::size_t count) requires (!kReadOnly) {
+                std::scoped_lock lock(mutex_);
+
+                if (offset > size_ || count > size_ - offset)
+                    throw std::out_of_range("JPrimitiveArray::MarkDirty(): range out of bounds");
+
+                AddDirty(offset, count);
+            }
+
+            // range must lie within Span(); std::less orders pointers into unrelated storage too
+            void MarkDirty(std::span<const Element> range) requires (!kReadOnly) {
                 std::scoped_lock lock(mutex_);
+
+                const Element* first = range.data();
+                const Element* last = first + range.size();
+                if (std::less<>{}(first, elements_) || std::greater<>{}(last, elements_ + size_))
+                    throw std::out_of_range("JPrimitiveArray::MarkDirty(): span outside the array");
+
+                AddDirty(static_cast<std::size_t>(first - elements_), range.size());
+            }
+
+            // Only assignment changes the size, and Synchronized arrays have none, so this never locks
+            [[nodiscard]] auto Size() const noexcept -> std::size_t {
                 return size_;
             }
 
@@ -1641,51 +2296,213 @@ namespace jb {
                 return array_.Get();
             }
 
-            [[nodiscard]] auto begin() -> ElementType* { return elements_; }
+            // Mutable raw access cannot be tracked, so it marks the whole array dirty;
+            // read through cbegin()/cend() or Span() to keep TrackWrites() effective
+            [[nodiscard]] auto begin() -> ElementType* { RecordWrite(0, size_); return elements_; }
             [[nodiscard]] auto end() -> ElementType* { return elements_ + size_; }
             [[nodiscard]] auto begin() const -> const ElementType* { return elements_; }
             [[nodiscard]] auto end() const -> const ElementType* { return elements_ + size_; }
-            [[nodiscard]] auto data() -> ElementType* { return elements_; }
+            [[nodiscard]] auto cbegin() const -> const ElementType* { return elements_; }
+            [[nodiscard]] auto cend() const -> const ElementType* { return elements_ + size_; }
+            [[nodiscard]] auto data() -> ElementType* { RecordWrite(0, size_); return elements_; }
             [[nodiscard]] auto data() const -> const ElementType* { return elements_; }
+            [[nodiscard]] auto Span() const -> std::span<const Element> { return {elements_, size_}; }
             [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
 
         private:
-            void Release() {
-                if (elements_) {
-                    jni::ReleaseArrayRegion(env_, array_.Get(), elements_);
-                    elements_ = nullptr;
+            static constexpr std::size_t kMaxDirtyRanges = 32;
+
+            using DirtyRange = std::pair<std::size_t, std::size_t>; // [first, last)
+
+            // New Java array filled from the other wrapper's buffer, which may hold unflushed writes
+            [[nodiscard]] static auto CopyOf(JNIEnv* env, JPrimitiveArray const& o) -> JArrayType {
+                auto array = jni::NewPrimitiveArray<Element>(env, o.size_);
+                jni::SetArrayRegion(env, array, 0, static_cast<jsize>(o.size_), o.elements_);
+                return array;
+            }
+
+            // Used by the unlocked accessors, so it takes the lock around the range list itself
+            void RecordWrite(std::size_t offset, std::size_t count) {
+                if constexpr (!kReadOnly) {
+                    std::scoped_lock lock(mutex_);
+                    AddDirty(offset, count);
+                }
+            }
+
+            // Caller holds mutex_
+            void AddDirty(std::size_t offset, std::size_t count) {
+                if (!tracking_ || count == 0)
+                    return;
+
+                // Extend the last range for sequential writes
+                if (!dirty_.empty() && offset <= dirty_.back().second && offset + count >= dirty_.back().first) {
+                    dirty_.back().first = std::min(dirty_.back().first, offset);
+                    dirty_.back().second = std::max(dirty_.back().second, offset + count);
+                    return;
+                }
+
+                dirty_.emplace_back(offset, offset + count);
+
+                if (dirty_.size() > kMaxDirtyRanges) {
+                    CoalesceDirty();
+
+                    // Scattered writes: fall back to one bounding range
+                    if (dirty_.size() > kMaxDirtyRanges / 2) {
+                        dirty_ = {DirtyRange{dirty_.front().first, dirty_.back().second}};
+                    }
+                }
+            }
+
+            void CoalesceDirty() {
+                std::sort(dirty_.begin(), dirty_.end());
+
+                std::size_t write = 0;
+                for (std::size_t read = 1; read < dirty_.size(); ++read) {
+                    if (dirty_[read].first <= dirty_[write].second) {
+                        dirty_[write].second = std::max(dirty_[write].second, dirty_[read].second);
+                    } else {
+                        dirty_[++write] = dirty_[read];
+                    }
+                }
+                dirty_.resize(dirty_.empty() ? 0 : write + 1);
+            }
+
+            void Release() {
+                if (elements_) {
+                    auto* elements = const_cast<Element*>(elements_);
+
+                    if constexpr (kReadOnly) {
+                        jni::ReleaseArrayRegion(env_, array_.Get(), elements, JNI_ABORT);
+                    } else if (tracking_) {
+                        // A pinned buffer already is the Java array; only copies need flushing
+                        if (is_copy_) {
+                            auto array = array_.Get();
+                            CoalesceDirty();
+                            for (auto [first, last] : dirty_) {
+                                jni::SetArrayRegion(env_, array, static_cast<jsize>(first), 
+                                                    static_cast<jsize>(last - first), elements_ + first);
+                            }
+                        }
+                        jni::ReleaseArrayRegion(env_, array_.Get(), elements, JNI_ABORT);
+                    } else {
+                        jni::ReleaseArrayRegion(env_, array_.Get(), elements);
+                    }
+                    elements_ = nullptr;
+                    dirty_.clear();
                 }
             }
 
         private:
             JNIEnv* env_ = nullptr;
             jni::JniObject<JArrayType> array_;
+            jboolean is_copy_ = JNI_FALSE;
             ElementType* elements_ = nullptr;
             std::size_t size_ = 0;
-            mutable std::mutex mutex_;
+            bool tracking_ = false;
+            std::vector<DirtyRange> dirty_;
+            [[no_unique_address]] mutable typename ThreadingPolicy::mutex_type mutex_;
         };
 
         // ========================================================================
         // JObjectArray: Wrapper for JNI object arrays
         // ========================================================================
 
-        template<typename MirrorClass>
+        template<typename MirrorClass, typename ThreadingPolicy>
         class JObjectArray {
             static constexpr std::size_t kDefaultCapacity = 10;
 
         public:
+            // Input iterator that holds at most one element ref, deleted when it advances.
+            // A dereferenced element is valid until then; promote it to keep it longer.
+            class Iterator {
+            public:
+                using iterator_concept = std::input_iterator_tag;
+                using difference_type = std::ptrdiff_t;
+                using value_type = ObjectRef<MirrorClass>;
+
+                Iterator() = default;
+
+                Iterator(JObjectArray* array, std::size_t index) noexcept 
+                    : array_(array), index_(index) {}
+
+                // Copies refetch their element instead of sharing the ref
+                Iterator(Iterator const& o) noexcept 
+                    : array_(o.array_), index_(o.index_) {}
+
+                Iterator& operator=(Iterator const& o) noexcept {
+                    if (this != &o) {
+                        Release();
+                        array_ = o.array_;
+                        index_ = o.index_;
+                    }
+                    return *this;
+                }
+
+                Iterator(Iterator&& o) noexcept 
+                    : array_(o.array_)
+                    , index_(o.index_)
+                    , current_(std::exchange(o.current_, nullptr)) 
+                {}
+
+                Iterator& operator=(Iterator&& o) noexcept {
+                    if (this != &o) {
+                        Release();
+                        array_ = o.array_;
+                        index_ = o.index_;
+                        current_ = std::exchange(o.current_, nullptr);
+                    }
+                    return *this;
+                }
+
+                ~Iterator() {
+                    Release();
+                }
+
+                [[nodiscard]] auto operator*() const -> value_type {
+                    if (!current_)
+                        current_ = array_->GetAsRaw(index_);
+                    return value_type{current_};
+                }
+
+                Iterator& operator++() {
+                    Release();
+                    ++index_;
+                    return *this;
+                }
+
+                void operator++(int) {
+                    ++*this;
+                }
+
+                [[nodiscard]] friend auto operator==(Iterator const& lhs, Iterator const& rhs) noexcept -> bool {
+                    return lhs.index_ == rhs.index_;
+                }
+
+            private:
+                void Release() noexcept {
+                    if (current_) {
+                        array_->env_->DeleteLocalRef(current_);
+                        current_ = nullptr;
+                    }
+                }
+
+                JObjectArray* array_ = nullptr;
+                std::size_t index_ = 0;
+                mutable jobject current_ = nullptr;
+            };
+
             JObjectArray() : JObjectArray(kDefaultCapacity) {}
 
             explicit JObjectArray(std::size_t size) 
                 : env_(jni::GetEnv())
-                , class_(env_->FindClass(traits::class_signature_v<MirrorClass>.data()))
+                , class_(jni::FindClassFor<MirrorClass>())
                 , array_(env_->NewObjectArray(static_cast<jsize>(size), class_.Get(), nullptr))
                 , size_(size) 
             {}
 
             explicit JObjectArray(jobjectArray array) 
                 : env_(jni::GetEnv())
-                , class_(env_->FindClass(traits::class_signature_v<MirrorClass>.data()))
+                , class_(jni::FindClassFor<MirrorClass>())
                 , array_(array)
                 , size_(static_cast<std::size_t>(env_->GetArrayLength(array))) 
             {}
@@ -1700,7 +2517,7 @@ namespace jb {
                 , size_(o.size_) 
             {}
 
-            JObjectArray& operator=(JObjectArray const& o) {
+            JObjectArray& operator=(JObjectArray const& o) requires (!std::same_as<ThreadingPolicy, Synchronized>) {
                 if (this == &o)
                     return *this;
 
@@ -1757,8 +2574,8 @@ namespace jb {
                 Set(index, static_cast<jobject>(element));
             }
 
-            [[nodiscard]] auto Size() const -> std::size_t {
-                std::scoped_lock lock(mutex_);
+            // Only assignment changes the size, and Synchronized arrays have none, so this never locks
+            [[nodiscard]] auto Size() const noexcept -> std::size_t {
                 return size_;
             }
 
@@ -1770,12 +2587,179 @@ namespace jb {
                 return size_ == 0;
             }
 
+            // Iteration runs in constant local-ref space: for (java::lang::reflect::Method m : methods)
+            [[nodiscard]] auto begin() -> Iterator {
+                env_->EnsureLocalCapacity(1);
+                return Iterator{this, 0};
+            }
+
+            [[nodiscard]] auto end() -> Iterator {
+                return Iterator{this, size_};
+            }
+
+            [[nodiscard]] auto begin() const -> Iterator {
+                return const_cast<JObjectArray*>(this)->begin();
+            }
+
+            [[nodiscard]] auto end() const -> Iterator {
+                return const_cast<JObjectArray*>(this)->end();
+            }
+
+            // Calls fn with every element (valid until fn returns) in constant local-ref space.
+            // frame_every == 0: each element's ref is deleted after fn returns.
+            // frame_every == N: a local frame is pushed for every N elements, so refs fn creates are reclaimed too.
+            template<typename Fn>
+                requires std::invocable<Fn&, ObjectRef<MirrorClass>>
+            void ForEach(Fn&& fn, std::size_t frame_every = 0) {
+                if (frame_every == 0) {
+                    if (env_->EnsureLocalCapacity(1) != JNI_OK)
+                        throw std::runtime_error("JObjectArray::ForEach(): EnsureLocalCapacity() failed");
+
+                    for (std::size_t i = 0; i < size_; ++i) {
+                        auto element = GetAsRaw(i);
+                        struct Release {
+                            JNIEnv* env;
+                            jobject ref;
+                            ~Release() { env->DeleteLocalRef(ref); }
+                        } release{env_, element};
+
+                        fn(ObjectRef<MirrorClass>{element});
+                    }
+                    return;
+                }
+
+                // Room for the batch's elements plus refs created by fn
+                auto capacity = static_cast<jint>(std::min<std::size_t>(frame_every * 2, std::numeric_limits<jint>::max()));
+                for (std::size_t first = 0; first < size_; first += frame_every) {
+                    if (env_->PushLocalFrame(capacity) != JNI_OK)
+                        throw std::runtime_error("JObjectArray::ForEach(): PushLocalFrame() failed");
+
+                    struct Pop {
+                        JNIEnv* env;
+                        ~Pop() { env->PopLocalFrame(nullptr); }
+                    } pop{env_};
+
+                    auto last = std::min(first + frame_every, size_);
+                    for (std::size_t i = first; i < last; ++i)
+                        fn(ObjectRef<MirrorClass>{GetAsRaw(i)});
+                }
+            }
+
         private:
             JNIEnv* env_;
             jni::JniObject<jclass> class_;
             jni::JniObject<jobjectArray> array_;
             std::size_t size_;
-            mutable std::mutex mutex_;
+            [[no_unique_address]] mutable typename ThreadingPolicy::mutex_type mutex_;
+        };
+
+        // ========================================================================
+        // JDirectBuffer: Typed zero-copy view of a direct java.nio.ByteBuffer
+        // ========================================================================
+
+        template<typename ElementType>
+        class JDirectBuffer {
+            static_assert(std::is_trivially_copyable_v<ElementType>, "DirectBuffer element must be trivially copyable");
+
+        public:
+            JDirectBuffer() = default;
+
+            // Wraps an existing direct buffer
+            explicit JDirectBuffer(jobject buffer) 
+                : buffer_(buffer) 
+            {
+                auto env = jni::GetEnv();
+                auto* address = env->GetDirectBufferAddress(buffer);
+                auto capacity = env->GetDirectBufferCapacity(buffer);
+
+                if (!address || capacity < 0)
+                    throw std::invalid_argument("DirectBuffer: not a direct buffer");
+
+                if (reinterpret_cast<std::uintptr_t>(address) % alignof(ElementType) != 0)
+                    throw std::invalid_argument("DirectBuffer: buffer address is misaligned for element type");
+
+                data_ = static_cast<ElementType*>(address);
+                size_ = static_cast<std::size_t>(capacity) / sizeof(ElementType);
+            }
+
+            // Allocates a Java-owned buffer (ByteBuffer.allocateDirect) in native byte order.
+            // Any integer size: a plain size_t overload would make DirectBuffer(0) ambiguous with jobject.
+            template<std::integral SizeType>
+            explicit JDirectBuffer(SizeType size) 
+                : JDirectBuffer(AllocateDirect(size)) {}
+
+            // Exposes caller-owned memory to Java; it must outlive every Java use of the buffer
+            explicit JDirectBuffer(std::span<ElementType> memory) 
+                : buffer_(jni::GetEnv()->NewDirectByteBuffer(
+                      static_cast<void*>(memory.data()), static_cast<jlong>(memory.size_bytes())))
+                , data_(memory.data())
+                , size_(memory.size()) 
+            {
+                if (!buffer_)
+                    throw std::runtime_error("DirectBuffer: NewDirectByteBuffer() failed");
+            }
+
+            [[nodiscard]] auto operator[](std::size_t index) const -> ElementType& {
+                return data_[index];
+            }
+
+            [[nodiscard]] auto Span() const noexcept -> std::span<ElementType> {
+                return {data_, size_};
+            }
+
+            [[nodiscard]] auto Size() const noexcept -> std::size_t { return size_; }
+            [[nodiscard]] auto SizeBytes() const noexcept -> std::size_t { return size_ * sizeof(ElementType); }
+            [[nodiscard]] auto Raw() const noexcept -> jobject { return buffer_.Get(); }
+            [[nodiscard]] auto begin() const noexcept -> ElementType* { return data_; }
+            [[nodiscard]] auto end() const noexcept -> ElementType* { return data_ + size_; }
+            [[nodiscard]] auto data() const noexcept -> ElementType* { return data_; }
+            [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+        private:
+            template<std::integral SizeType>
+            [[nodiscard]] static auto AllocateDirect(SizeType size) -> jobject {
+                static constexpr auto kByteBuffer = str::arrayify("java/nio/ByteBuffer");
+                static constexpr auto kByteOrder = str::arrayify("java/nio/ByteOrder");
+                static constexpr auto kMaxSize = static_cast<std::size_t>(std::numeric_limits<jint>::max()) / sizeof(ElementType);
+
+                if (std::cmp_less(size, 0))
+                    throw std::length_error("DirectBuffer: negative size");
+
+                // Checked before multiplying, so the byte count cannot wrap
+                if (std::cmp_greater(size, kMaxSize))
+                    throw std::length_error("DirectBuffer: capacity exceeds Integer.MAX_VALUE");
+
+                auto bytes = static_cast<std::size_t>(size) * sizeof(ElementType);
+
+                auto env = jni::GetEnv();
+                auto buffer_class = jni::FindCachedClass<kByteBuffer>();
+                auto order_class = jni::FindCachedClass<kByteOrder>();
+
+                static jmethodID allocate_direct = 
+                    env->GetStaticMethodID(buffer_class, "allocateDirect", "(I)Ljava/nio/ByteBuffer;");
+                static jmethodID order = 
+                    env->GetMethodID(buffer_class, "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
+                static jmethodID native_order = 
+                    env->GetStaticMethodID(order_class, "nativeOrder", "()Ljava/nio/ByteOrder;");
+
+                auto buffer = env->CallStaticObjectMethod(buffer_class, allocate_direct, static_cast<jint>(bytes));
+                if (!buffer) {
+                    // Usually an OutOfMemoryError; raised even inside an ExceptionScope, since nothing can proceed
+                    if (env->ExceptionCheck())
+                        jni::RaisePendingException(env);
+                    throw std::runtime_error("DirectBuffer: ByteBuffer.allocateDirect() failed");
+                }
+
+                auto byte_order = env->CallStaticObjectMethod(order_class, native_order);
+                env->DeleteLocalRef(env->CallObjectMethod(buffer, order, byte_order));
+                env->DeleteLocalRef(byte_order);
+
+                return buffer;
+            }
+
+            jni::JniObject<jobject> buffer_;
+            ElementType* data_ = nullptr;
+            std::size_t size_ = 0;
         };
 
     } // namespace detail
@@ -1798,122 +2782,3566 @@ namespace jb {
         return {MakeGlobalRef<Op>(GetEnv(), object), DeleteGlobalRefWithoutJNIEnv};
     }
 
-    inline void Init(JavaVM* vm) noexcept {
-        detail::jni::vm_ = vm;
-    }
+    // ============================================================================
+    // LocalFrame: RAII scope for PushLocalFrame/PopLocalFrame
+    // ============================================================================
 
-} // namespace jb
+    class LocalFrame {
+    public:
+        explicit LocalFrame(jint capacity = kDefaultCapacity, JNIEnv* env = detail::jni::GetEnv())
+            : env_(env) 
+        {
+            if (env_->PushLocalFrame(capacity) != JNI_OK)
+                throw std::runtime_error("LocalFrame: PushLocalFrame() failed");
+        }
 
-// ============================================================================
-// Macros - Forward Declaration Support (Cyclic Reference Resolution)
-// ============================================================================
+        LocalFrame(LocalFrame const&) = delete;
+        LocalFrame& operator=(LocalFrame const&) = delete;
+        LocalFrame(LocalFrame&&) = delete;
+        LocalFrame& operator=(LocalFrame&&) = delete;
 
-// Generate class signature from package::class_name
-#define JBRIDGE_INTERNAL_MAKE_SIGNATURE(package, class_name) \
-    [] { \
-        using namespace jb::detail; \
-        auto symbol = arrayify(#package "::" #class_name); \
-        constexpr auto symbol_size = arraysize_of(symbol); \
-        std::array<char, symbol_size - namespace_depth(arrayify(#package "::" #class_name))> signature{}; \
-        replace_scope_to_slash(signature, symbol); \
-        return signature; \
-    }()
+        ~LocalFrame() {
+            if (active_) {
+                env_->PopLocalFrame(nullptr);
+            }
+        }
 
-// Forward declare a mirror class (enables cyclic references)
-// Usage: JBRIDGE_DECLARE_CLASS(java::lang::reflect, Method)
-#define JBRIDGE_DECLARE_CLASS(package, class_name) \
-    namespace package { struct class_name; } \
-    template<> \
-    struct jb::traits::class_signature_override<package::class_name> { \
-        static constexpr auto value = JBRIDGE_INTERNAL_MAKE_SIGNATURE(package, class_name); \
+        // Pop the frame and carry result over to the enclosing frame as a new local ref
+        template<typename Tp>
+        [[nodiscard]] auto Promote(Tp result) -> Tp {
+            if constexpr (concepts::JniObjectType<Tp>) {
+                return static_cast<Tp>(Pop(result));
+            } else if constexpr (concepts::DerivedFromJBase<Tp>) {
+                return Tp{Pop(result.GetObject())};
+            } else if constexpr (requires { requires std::same_as<Tp, ObjectRef<typename Tp::mirror_type>>; }) {
+                return Tp{Pop(result.get())};
+            } else {
+                static_assert(traits::deferred_false<Tp>::value, "Cannot promote type out of LocalFrame");
+            }
+        }
+
+    private:
+        static constexpr jint kDefaultCapacity = 16;
+
+        auto Pop(jobject result) -> jobject {
+            if (!active_)
+                throw std::logic_error("LocalFrame::Promote(): frame already popped");
+
+            active_ = false;
+            return env_->PopLocalFrame(result);
+        }
+
+        JNIEnv* env_;
+        bool active_ = true;
     };
 
-// ============================================================================
-// Macros - Class Definition (Interface preserved for compatibility)
-// ============================================================================
+    // ============================================================================
+    // GlobalRefArena: Slot storage for bulk global references
+    // ============================================================================
 
-#define JBRIDGE_DEFINE_CLASS(package, class_name, class_scope)                                                      \
-namespace package {                                                                                                 \
-                                                                                                                    \
-    template<typename D>                                                                                            \
-    struct _M_base_ ## class_name {                                                                                 \
-                                                                                                                    \
-        static constexpr auto CLASS_SIGNATURE = JBRIDGE_INTERNAL_MAKE_SIGNATURE(package, class_name);               \
-                                                                                                                    \
-        template<typename ...Args>                                                                                  \
-        [[nodiscard]] static auto new_(Args&&... args) -> D {                                                       \
-            static auto constructor = jb::detail::CreateConstructor<Args...>(CLASS_SIGNATURE);                      \
-            return D{constructor.call(jb::detail::jni::FindClass(CLASS_SIGNATURE), std::forward<Args>(args)...)};   \
-        }                                                                                                           \
-    };                                                                                                              \
-                                                                                                                    \
-    struct class_name : public jb::detail::BaseClass<class_name>, public _M_base_ ## class_name<class_name> class_scope; \
-}
+    // Promotes objects into one contiguous slot vector and hands out index/generation handles.
+    // Releasing a slot is a single DeleteGlobalRef (the arena knows what it owns), and Clear()
+    // drops every slot in one pass. Stale handles resolve to nullptr instead of a reused slot.
+    template<typename ThreadingPolicy = Unsynchronized>
+    class GlobalRefArena {
+    public:
+        struct Handle {
+            std::uint32_t index = 0;
+            std::uint32_t generation = 0;   // 0: null handle
 
-#define JBRIDGE_REQUIRE_EXTENDED_CONSTRUCTION(class_name) using jb::detail::BaseClass<class_name>::BaseClass;
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return generation != 0;
+            }
 
-// ============================================================================
-// Macros - Method Definition (supports cyclic references via method_return_t)
-// ============================================================================
+            [[nodiscard]] friend bool operator==(Handle, Handle) noexcept = default;
+        };
 
-#define JBRIDGE_DEFINE_METHOD(return_type, name, ...)                                                               \
-template<typename ...Args>                                                                                          \
-auto name(Args&&... args) {                                                                                         \
-    static auto name ## _ = jb::detail::CreateMethod<false, return_type __VA_OPT__(,) __VA_ARGS__>(CLASS_SIGNATURE, #name); \
-    if constexpr (std::is_void_v<return_type>) {                                                                    \
-        name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...);                                 \
-    } else {                                                                                                        \
-        return jb::traits::method_return_t<return_type>(name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...)); \
-    }                                                                                                               \
-}
+        static constexpr std::size_t kDefaultCapacity = 32768;
 
-#define JBRIDGE_DEFINE_ALIAS_METHOD(return_type, alias_name, name, ...)                                             \
-template<typename ...Args>                                                                                          \
-auto alias_name(Args&&... args) {                                                                                   \
-    static auto name ## _ = jb::detail::CreateMethod<false, return_type __VA_OPT__(,) __VA_ARGS__>(CLASS_SIGNATURE, #name); \
-    if constexpr (std::is_void_v<return_type>) {                                                                    \
-        name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...);                                 \
-    } else {                                                                                                        \
-        return jb::traits::method_return_t<return_type>(name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...)); \
-    }                                                                                                               \
-}
+        // capacity: upper bound on live refs; keep it below the VM's global reference limit
+        explicit GlobalRefArena(std::size_t capacity = kDefaultCapacity)
+            : capacity_(std::min<std::size_t>(capacity, kNoSlot)) {}
 
-#define JBRIDGE_DEFINE_STATIC_METHOD(return_type, name, ...)                                                        \
-template<typename ...Args>                                                                                          \
-static auto name(Args&&... args) {                                                                                  \
-    static auto name ## _ = jb::detail::CreateMethod<true, return_type __VA_OPT__(,) __VA_ARGS__>(CLASS_SIGNATURE, #name); \
-    if constexpr (std::is_void_v<return_type>) {                                                                    \
-        name ## _.template call<true>(jb::detail::jni::FindClass(CLASS_SIGNATURE), std::forward<Args>(args)...);    \
-    } else {                                                                                                        \
-        return jb::traits::method_return_t<return_type>(name ## _.template call<true>(jb::detail::jni::FindClass(CLASS_SIGNATURE), std::forward<Args>(args)...)); \
-    }                                                                                                               \
-}
+        GlobalRefArena(GlobalRefArena const&) = delete;
+        GlobalRefArena& operator=(GlobalRefArena const&) = delete;
+        GlobalRefArena(GlobalRefArena&&) = delete;
+        GlobalRefArena& operator=(GlobalRefArena&&) = delete;
 
-#define JBRIDGE_DEFINE_STATIC_ALIAS_METHOD(return_type, alias_name, name, ...)                                      \
-template<typename ...Args>                                                                                          \
-static auto alias_name(Args&&... args) {                                                                            \
-    static auto name ## _ = jb::detail::CreateMethod<true, return_type __VA_OPT__(,) __VA_ARGS__>(CLASS_SIGNATURE, #name); \
-    if constexpr (std::is_void_v<return_type>) {                                                                    \
-        name ## _.template call<true>(jb::detail::jni::FindClass(CLASS_SIGNATURE), std::forward<Args>(args)...);    \
-    } else {                                                                                                        \
-        return jb::traits::method_return_t<return_type>(name ## _.template call<true>(jb::detail::jni::FindClass(CLASS_SIGNATURE), std::forward<Args>(args)...)); \
-    }                                                                                                               \
-}
+        ~GlobalRefArena() {
+            if (size_ != 0) {
+                Clear();
+            }
+        }
 
-// ============================================================================
-// Macros - Field Definition
-// ============================================================================
+        // Returns a null handle for a null object; throws std::length_error when the arena is full
+        [[nodiscard]] auto Promote(jobject object, JNIEnv* env = detail::jni::GetEnv()) -> Handle {
+            if (!object)
+                return {};
 
-#define JBRIDGE_DEFINE_FIELD(field_type, name)                                                                      \
-[[nodiscard]] decltype(auto) name() {                                                                               \
-    static auto field ## _ = jb::detail::CreateField<false, jb::traits::array_wrapper_t<field_type>>(CLASS_SIGNATURE, #name); \
-    return field ## _.Update(object_.Get());                                                                        \
-}
+            std::scoped_lock lock(mutex_);
 
-#define JBRIDGE_DEFINE_STATIC_FIELD(field_type, name)                                                               \
-[[nodiscard]] static decltype(auto) name() {                                                                        \
-    static auto field ## _ = jb::detail::CreateField<true, jb::traits::array_wrapper_t<field_type>>(CLASS_SIGNATURE, #name); \
-    return field ## _.Update(jb::detail::jni::FindClass(CLASS_SIGNATURE));                                          \
+            if (size_ == capacity_)
+                throw std::length_error("GlobalRefArena: capacity exhausted");
+
+            auto global = env->NewGlobalRef(object);
+            if (!global)
+                throw std::runtime_error("GlobalRefArena: NewGlobalRef() failed");
+
+            std::uint32_t index;
+            if (free_ != kNoSlot) {
+                index = free_;
+                free_ = slots_[index].next_free;
+            } else {
+                index = static_cast<std::uint32_t>(slots_.size());
+                slots_.push_back({});
+            }
+
+            auto& slot = slots_[index];
+            slot.ref = global;
+            slot.next_free = kNoSlot;
+            ++size_;
+            return {index, slot.generation};
+        }
+
+        template<typename Tp>
+            requires (!concepts::JniObjectType<Tp>)
+        [[nodiscard]] auto Promote(Tp& object, JNIEnv* env = detail::jni::GetEnv()) -> Handle {
+            if constexpr (concepts::DerivedFromJBase<Tp>) {
+                return Promote(object.GetObject(), env);
+            } else if constexpr (requires { requires std::same_as<Tp, ObjectRef<typename Tp::mirror_type>>; }) {
+                return Promote(object.get(), env);
+            } else {
+                static_assert(traits::deferred_false<Tp>::value, "Cannot promote type into GlobalRefArena");
+            }
+        }
+
+        // nullptr for null, released or cleared handles
+        [[nodiscard]] auto Get(Handle handle) const -> jobject {
+            std::scoped_lock lock(mutex_);
+            return Lookup(handle);
+        }
+
+        template<typename Mirror>
+        [[nodiscard]] auto Get(Handle handle) const -> ObjectRef<Mirror> {
+            return ObjectRef<Mirror>{Get(handle)};
+        }
+
+        [[nodiscard]] auto Contains(Handle handle) const -> bool {
+            return Get(handle) != nullptr;
+        }
+
+        // Deletes one ref; stale handles are ignored
+        void Release(Handle handle, JNIEnv* env = detail::jni::GetEnv()) {
+            std::scoped_lock lock(mutex_);
+
+            if (auto ref = Lookup(handle)) {
+                env->DeleteGlobalRef(ref);
+                Retire(handle.index);
+                --size_;
+            }
+        }
+
+        // Deletes every live ref and invalidates all outstanding handles
+        void Clear(JNIEnv* env = detail::jni::GetEnv()) {
+            std::scoped_lock lock(mutex_);
+
+            for (std::uint32_t index = 0; index < slots_.size(); ++index) {
+                if (auto ref = slots_[index].ref) {
+                    env->DeleteGlobalRef(ref);
+                    Retire(index);
+                }
+            }
+            size_ = 0;
+        }
+
+        // Live references
+        [[nodiscard]] auto Size() const -> std::size_t {
+            std::scoped_lock lock(mutex_);
+            return size_;
+        }
+
+        // Slots allocated so far (high-water mark of live references)
+        [[nodiscard]] auto Reserved() const -> std::size_t {
+            std::scoped_lock lock(mutex_);
+            return slots_.size();
+        }
+
+        [[nodiscard]] auto Capacity() const noexcept -> std::size_t {
+            return capacity_;
+        }
+
+    private:
+        static constexpr std::uint32_t kNoSlot = std::numeric_limits<std::uint32_t>::max();
+
+        struct Slot {
+            jobject ref = nullptr;
+            std::uint32_t generation = 1;
+            std::uint32_t next_free = kNoSlot;
+        };
+
+        auto Lookup(Handle handle) const -> jobject {
+            if (handle.index >= slots_.size())
+                return nullptr;
+
+            auto const& slot = slots_[handle.index];
+            return slot.generation == handle.generation ? slot.ref : nullptr;
+        }
+
+        void Retire(std::uint32_t index) {
+            auto& slot = slots_[index];
+            slot.ref = nullptr;
+            // Skip 0 so a wrapped generation never matches a null handle
+            if (++slot.generation == 0)
+                slot.generation = 1;
+            slot.next_free = free_;
+            free_ = index;
+        }
+
+        std::vector<Slot> slots_;
+        std::uint32_t free_ = kNoSlot;
+        std::size_t size_ = 0;
+        std::size_t capacity_;
+        [[no_unique_address]] mutable typename ThreadingPolicy::mutex_type mutex_;
+    };
+
+    // ============================================================================
+    // WeakRef: Weak global reference with promotion on access
+    // ============================================================================
+
+    // Does not keep the object alive. Lock() upgrades to a strong local ref
+    // (NewLocalRef returns null once the object has been collected).
+    template<typename Mirror>
+    class WeakRef {
+    public:
+        using mirror_type = Mirror;
+
+        constexpr WeakRef() noexcept = default;
+
+        explicit WeakRef(jobject object, JNIEnv* env = detail::jni::GetEnv())
+            : weak_(object ? env->NewWeakGlobalRef(object) : nullptr) {}
+
+        template<typename M = Mirror>
+            requires concepts::DerivedFromJBase<M>
+        explicit WeakRef(M mirror, JNIEnv* env = detail::jni::GetEnv())
+            : WeakRef(mirror.GetObject(), env) {}
+
+        WeakRef(WeakRef const& o)
+            : weak_(o.weak_ ? detail::jni::GetEnv()->NewWeakGlobalRef(o.weak_) : nullptr) {}
+
+        WeakRef(WeakRef&& o) noexcept 
+            : weak_(std::exchange(o.weak_, nullptr)) {}
+
+        WeakRef& operator=(WeakRef o) noexcept {
+            std::swap(weak_, o.weak_);
+            return *this;
+        }
+
+        ~WeakRef() {
+            Reset();
+        }
+
+        // Strong local ref to the object, or a null ref if it has been collected
+        [[nodiscard]] auto Lock(JNIEnv* env = detail::jni::GetEnv()) const -> ObjectRef<Mirror> {
+            return ObjectRef<Mirror>{weak_ ? env->NewLocalRef(weak_) : nullptr};
+        }
+
+        // Advisory only: the object may be collected right after this returns false
+        [[nodiscard]] auto Expired(JNIEnv* env = detail::jni::GetEnv()) const -> bool {
+            return !weak_ || env->IsSameObject(weak_, nullptr);
+        }
+
+        void Reset() {
+            if (auto weak = std::exchange(weak_, nullptr)) {
+                detail::jni::GetEnv()->DeleteWeakGlobalRef(weak);
+            }
+        }
+
+        [[nodiscard]] auto Raw() const noexcept -> jweak {
+            return weak_;
+        }
+
+        // True if the ref was ever bound, not whether the object is still alive
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return weak_ != nullptr;
+        }
+
+    private:
+        jweak weak_ = nullptr;
+    };
+
+    // ============================================================================
+    // WeakCache: Native-side map of weakly held Java objects
+    // ============================================================================
+
+    // Entries whose object has been collected are dropped lazily by Get(),
+    // or all at once by Purge().
+    template<typename Key, typename Mirror, typename ThreadingPolicy = Unsynchronized,
+             typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class WeakCache {
+    public:
+        WeakCache() = default;
+
+        WeakCache(WeakCache const&) = delete;
+        WeakCache& operator=(WeakCache const&) = delete;
+
+        void Put(Key const& key, jobject object, JNIEnv* env = detail::jni::GetEnv()) {
+            WeakRef<Mirror> weak(object, env);
+
+            std::scoped_lock lock(mutex_);
+            entries_.insert_or_assign(key, std::move(weak));
+        }
+
+        template<typename M = Mirror>
+            requires concepts::DerivedFromJBase<M>
+        void Put(Key const& key, M mirror, JNIEnv* env = detail::jni::GetEnv()) {
+            Put(key, mirror.GetObject(), env);
+        }
+
+        // Strong local ref, or a null ref if the key is absent or its object was collected
+        [[nodiscard]] auto Get(Key const& key, JNIEnv* env = detail::jni::GetEnv()) -> ObjectRef<Mirror> {
+            std::scoped_lock lock(mutex_);
+
+            auto it = entries_.find(key);
+            if (it == entries_.end())
+                return {};
+
+            auto strong = it->second.Lock(env);
+            if (!strong) {
+                entries_.erase(it);
+            }
+            return strong;
+        }
+
+        auto Erase(Key const& key) -> bool {
+            std::scoped_lock lock(mutex_);
+            return entries_.erase(key) != 0;
+        }
+
+        // Drops every collected entry; returns how many were removed
+        auto Purge(JNIEnv* env = detail::jni::GetEnv()) -> std::size_t {
+            std::scoped_lock lock(mutex_);
+            return std::erase_if(entries_, [env](auto const& entry) {
+                return entry.second.Expired(env);
+            });
+        }
+
+        void Clear() {
+            std::scoped_lock lock(mutex_);
+            entries_.clear();
+        }
+
+        // Includes collected entries that have not been dropped yet
+        [[nodiscard]] auto Size() const -> std::size_t {
+            std::scoped_lock lock(mutex_);
+            return entries_.size();
+        }
+
+    private:
+        std::unordered_map<Key, WeakRef<Mirror>, Hash, KeyEqual> entries_;
+        [[no_unique_address]] mutable typename ThreadingPolicy::mutex_type mutex_;
+    };
+
+    // ============================================================================
+    // Java Exceptions: Pending exception checks after JNI calls
+    // ============================================================================
+
+    // A Java exception raised by a mirror call. Holds the throwable as a global ref;
+    // its class name and message are fetched on first use through cached Throwable/Class method IDs.
+    class JavaException : public std::exception {
+    public:
+        // Takes over a local ref to the throwable
+        explicit JavaException(jthrowable throwable, JNIEnv* env = detail::jni::GetEnv())
+            : state_(std::make_shared<State>()) 
+        {
+            state_->throwable = detail::jni::MakeGlobalRef<jthrowable>(env, throwable);
+            env->DeleteLocalRef(throwable);
+        }
+
+        [[nodiscard]] auto what() const noexcept -> const char* override {
+            Describe();
+            return state_->what.c_str();
+        }
+
+        // e.g. "java.lang.IllegalStateException"
+        [[nodiscard]] auto ClassName() const -> std::string_view {
+            Describe();
+            return state_->class_name;
+        }
+
+        [[nodiscard]] auto Message() const -> std::string_view {
+            Describe();
+            return state_->message;
+        }
+
+        [[nodiscard]] auto Throwable() const noexcept -> jthrowable {
+            return state_->throwable;
+        }
+
+        // Throws the original throwable back into Java (e.g. before returning from a native method)
+        void Rethrow(JNIEnv* env = detail::jni::GetEnv()) const {
+            env->Throw(state_->throwable);
+        }
+
+    private:
+        struct State {
+            jthrowable throwable{};
+            std::once_flag described;
+            std::string class_name;
+            std::string message;
+            std::string what;
+
+            ~State() {
+                if (throwable) {
+                    detail::jni::DeleteGlobalRefWithoutJNIEnv(throwable);
+                }
+            }
+        };
+
+        void Describe() const noexcept {
+            std::call_once(state_->described, [state = state_.get()] {
+                using namespace detail::jni;
+                auto env = GetEnv();
+
+                // Another exception may be pending (e.g. what() called from a catch block mid-call)
+                auto pending = env->ExceptionOccurred();
+                if (pending)
+                    env->ExceptionClear();
+
+                static jmethodID get_name = env->GetMethodID(
+                    FindCachedClass<str::arrayify("java/lang/Class")>(), "getName", "()Ljava/lang/String;");
+                static jmethodID get_message = env->GetMethodID(
+                    FindCachedClass<str::arrayify("java/lang/Throwable")>(), "getMessage", "()Ljava/lang/String;");
+
+                auto cls = env->GetObjectClass(state->throwable);
+                auto name = static_cast<jstring>(env->CallObjectMethod(cls, get_name));
+                auto message = static_cast<jstring>(env->CallObjectMethod(state->throwable, get_message));
+                if (env->ExceptionCheck())
+                    env->ExceptionClear();
+
+                try {
+                    state->class_name = ToStdString(name, Utf8Mode::Standard, env);
+                    state->message = ToStdString(message, Utf8Mode::Standard, env);
+                    state->what = state->message.empty() 
+                        ? state->class_name 
+                        : state->class_name + ": " + state->message;
+                } catch (...) {
+                    // Out of memory: leave the description empty
+                }
+
+                env->DeleteLocalRef(message);
+                env->DeleteLocalRef(name);
+                env->DeleteLocalRef(cls);
+
+                if (pending) {
+                    env->Throw(pending);
+                    env->DeleteLocalRef(pending);
+                }
+            });
+        }
+
+        std::shared_ptr<State> state_;
+    };
+
+    namespace detail::jni {
+
+        // Number of ExceptionScopes alive on this thread
+        inline thread_local int deferred_checks_ = 0;
+
+        // Define JBRIDGE_ABORT_ON_JAVA_EXCEPTION to abort instead of throwing jb::JavaException
+        [[noreturn]] inline void RaisePendingException(JNIEnv* env) {
+#if defined(JBRIDGE_ABORT_ON_JAVA_EXCEPTION)
+            env->ExceptionDescribe();
+            env->FatalError("JBridge: uncaught Java exception");
+            std::abort();
+#else
+            auto throwable = env->ExceptionOccurred();
+            env->ExceptionClear();
+            throw JavaException(throwable, env);
+#endif
+        }
+
+        // The success path costs one ExceptionCheck
+        inline void CheckException(JNIEnv* env) {
+            if (deferred_checks_ == 0 && env->ExceptionCheck()) [[unlikely]] {
+                RaisePendingException(env);
+            }
+        }
+
+    } // namespace detail::jni
+
+    // Batches the per-call exception check of every mirror call in the scope into one check, 
+    // made at Check() or when the scope ends. JNI forbids most calls while an exception is pending, 
+    // so only batch calls whose failure does not feed later calls in the same scope.
+    class ExceptionScope {
+    public:
+        explicit ExceptionScope(JNIEnv* env = detail::jni::GetEnv()) 
+            : env_(env)
+            , uncaught_(std::uncaught_exceptions()) 
+        {
+            ++detail::jni::deferred_checks_;
+        }
+
+        ExceptionScope(ExceptionScope const&) = delete;
+        ExceptionScope& operator=(ExceptionScope const&) = delete;
+
+        // Skips the final check while another exception is unwinding the scope
+        ~ExceptionScope() noexcept(false) {
+            --detail::jni::deferred_checks_;
+            if (std::uncaught_exceptions() == uncaught_ && env_->ExceptionCheck())
+                detail::jni::RaisePendingException(env_);
+        }
+
+        void Check() {
+            if (env_->ExceptionCheck())
+                detail::jni::RaisePendingException(env_);
+        }
+
+    private:
+        JNIEnv* env_;
+        int uncaught_;
+    };
+
+#if defined(__cpp_lib_expected)
+    // Runs fn and returns its result, or the Java exception it raised
+    template<typename Fn>
+        requires std::invocable<Fn&>
+    [[nodiscard]] inline auto Try(Fn&& fn) -> std::expected<std::invoke_result_t<Fn&>, JavaException> {
+        try {
+            if constexpr (std::is_void_v<std::invoke_result_t<Fn&>>) {
+                fn();
+                return {};
+            } else {
+                return fn();
+            }
+        } catch (JavaException const& e) {
+            return std::unexpected(e);
+        }
+    }
+#endif
+
+    // ============================================================================
+    // StringCache: Bounded LRU of interned Strings for runtime keys
+    // ============================================================================
+
+    // Opt-in cache for strings passed repeatedly (map keys, property names).
+    // Lookups hand out a call-scoped local ref, so eviction never invalidates an argument in flight.
+    class StringCache {
+    public:
+        explicit StringCache(std::size_t capacity) : capacity_(capacity) {
+            if (capacity_ == 0)
+                throw std::invalid_argument("StringCache: capacity must be non-zero");
+        }
+
+        StringCache(StringCache const&) = delete;
+        StringCache& operator=(StringCache const&) = delete;
+
+        ~StringCache() {
+            Clear();
+        }
+
+        // Usage: map.put(cache[key], value)
+        [[nodiscard]] auto operator[](std::string_view key) -> detail::jni::TemporaryRef<jstring> {
+            return Get(key);
+        }
+
+        [[nodiscard]] auto Get(std::string_view key, JNIEnv* env = detail::jni::GetEnv()) -> detail::jni::TemporaryRef<jstring> {
+            std::lock_guard lock(mutex_);
+
+            if (auto it = index_.find(key); it != index_.end()) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return {env, static_cast<jstring>(env->NewLocalRef(it->second->string))};
+            }
+
+            std::string text(key);
+            auto local = env->NewStringUTF(text.c_str());
+            if (!local)
+                throw std::runtime_error("StringCache::Get(): NewStringUTF() failed");
+
+            if (entries_.size() == capacity_) {
+                auto& oldest = entries_.back();
+                index_.erase(oldest.text);
+                env->DeleteGlobalRef(oldest.string);
+                entries_.pop_back();
+            }
+
+            // List nodes never move, so the index can key on views into them
+            entries_.push_front({std::move(text), detail::jni::MakeGlobalRef<jstring>(env, local)});
+            index_.emplace(entries_.front().text, entries_.begin());
+            return {env, local};
+        }
+
+        void Clear() {
+            std::lock_guard lock(mutex_);
+            if (entries_.empty())
+                return;
+
+            auto env = detail::jni::GetEnv();
+            for (auto& entry : entries_)
+                env->DeleteGlobalRef(entry.string);
+            index_.clear();
+            entries_.clear();
+        }
+
+        [[nodiscard]] auto Size() const -> std::size_t {
+            std::lock_guard lock(mutex_);
+            return entries_.size();
+        }
+
+        [[nodiscard]] auto Capacity() const noexcept -> std::size_t {
+            return capacity_;
+        }
+
+    private:
+        struct Entry {
+            std::string text;
+            jstring string;
+        };
+
+        std::size_t capacity_;
+        mutable std::mutex mutex_;
+        std::list<Entry> entries_;
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;
+    };
+
+    // ============================================================================
+    // Boxing: Primitive values and ranges to java.lang wrapper objects
+    // ============================================================================
+
+    // Returns a new local ref; small values come from the boxed-value cache without calling valueOf
+    template<concepts::JniPrimitive T>
+    [[nodiscard]] inline auto Box(T value, JNIEnv* env = detail::jni::GetEnv()) -> jobject {
+        return detail::jni::Box(env, value);
+    }
+
+    // Boxes a whole range into a wrapper array (e.g. Integer[]) in one pass.
+    // Cached values are stored straight from their global refs.
+    template<std::ranges::sized_range R>
+        requires concepts::JniPrimitive<std::ranges::range_value_t<R>>
+    [[nodiscard]] inline auto BoxAll(R&& values, JNIEnv* env = detail::jni::GetEnv()) -> jobjectArray {
+        using namespace detail::jni;
+        using V = box_value_t<std::ranges::range_value_t<R>>;
+
+        auto size = std::ranges::size(values);
+        if (size > static_cast<std::size_t>(std::numeric_limits<jsize>::max()))
+            throw std::length_error("BoxAll(): range too large for a Java array");
+
+        auto array = env->NewObjectArray(static_cast<jsize>(size), BoxClass<V>(), nullptr);
+        if (!array)
+            throw std::runtime_error("BoxAll(): NewObjectArray() failed");
+
+        jsize index = 0;
+        for (auto&& element : values) {
+            auto value = ToBoxValue(static_cast<std::ranges::range_value_t<R>>(element));
+            if (auto boxed = BoxCached(env, value)) {
+                env->SetObjectArrayElement(array, index++, boxed);
+            } else {
+                auto local = env->CallStaticObjectMethod(BoxClass<V>(), BoxMethod<V>(), value);
+                env->SetObjectArrayElement(array, index++, local);
+                env->DeleteLocalRef(local);
+            }
+        }
+        return array;
+    }
+
+    // Hands each boxed element to fn (e.g. List.add); the ref is released once fn returns
+    template<std::ranges::input_range R, typename Fn>
+        requires concepts::JniPrimitive<std::ranges::range_value_t<R>> && std::invocable<Fn&, jobject>
+    inline void BoxEach(R&& values, Fn&& fn, JNIEnv* env = detail::jni::GetEnv()) {
+        using namespace detail::jni;
+        using V = box_value_t<std::ranges::range_value_t<R>>;
+
+        for (auto&& element : values) {
+            auto value = ToBoxValue(static_cast<std::ranges::range_value_t<R>>(element));
+            if (auto boxed = BoxCached(env, value)) {
+                std::invoke(fn, boxed);
+            } else {
+                auto local = env->CallStaticObjectMethod(BoxClass<V>(), BoxMethod<V>(), value);
+                std::invoke(fn, local);
+                env->DeleteLocalRef(local);
+            }
+        }
+    }
+
+    // ============================================================================
+    // CriticalView: Zero-copy scoped access via GetPrimitiveArrayCritical
+    // ============================================================================
+
+    // No JNI calls are allowed while a view is alive (asserted in debug builds).
+    // A const ElementType gives a read-only view released with JNI_ABORT.
+    // Views may nest (e.g. two-array kernels); open inner views with an explicit length.
+    template<typename ElementType>
+    class CriticalView {
+        using Element = std::remove_const_t<ElementType>;
+        using JArrayType = traits::primitive_array_t<Element>;
+
+    public:
+        // Calls GetArrayLength, so it must run before any other view on this thread is opened
+        explicit CriticalView(JArrayType array, JNIEnv* env = detail::jni::GetCriticalEnv())
+            : CriticalView(array, Length(array, env), env) {}
+
+        // No JNI call besides GetPrimitiveArrayCritical: safe while another view is alive
+        CriticalView(JArrayType array, std::size_t size, JNIEnv* env = detail::jni::GetCriticalEnv())
+            : env_(env)
+            , array_(array)
+            , size_(size)
+            , elements_(static_cast<ElementType*>(env_->GetPrimitiveArrayCritical(array, nullptr))) 
+        {
+            if (!elements_)
+                throw std::runtime_error("CriticalView: GetPrimitiveArrayCritical() failed");
+
+            detail::jni::EnterCritical();
+        }
+
+        // Read-only: the wrapper holds its own element buffer and writes it back on release,
+        // which would overwrite anything written through a mutable view of the same array
+        template<typename ArrayElement, typename ThreadingPolicy>
+            requires std::is_const_v<ElementType> && std::same_as<std::remove_const_t<ArrayElement>, Element>
+        explicit CriticalView(detail::JPrimitiveArray<JArrayType, ArrayElement, ThreadingPolicy> const& array, 
+                              JNIEnv* env = detail::jni::GetCriticalEnv())
+            : CriticalView(array.Raw(), array.Size(), env) {}
+
+        CriticalView(CriticalView const&) = delete;
+        CriticalView& operator=(CriticalView const&) = delete;
+        CriticalView(CriticalView&&) = delete;
+        CriticalView& operator=(CriticalView&&) = delete;
+
+        ~CriticalView() {
+            detail::jni::LeaveCritical();
+            env_->ReleasePrimitiveArrayCritical(
+                array_, const_cast<Element*>(elements_), 
+                std::is_const_v<ElementType> ? JNI_ABORT : 0
+            );
+        }
+
+        [[nodiscard]] auto operator[](std::size_t index) const -> ElementType& {
+            return elements_[index];
+        }
+
+        [[nodiscard]] auto Span() const noexcept -> std::span<ElementType> {
+            return {elements_, size_};
+        }
+
+        [[nodiscard]] auto Size() const noexcept -> std::size_t { return size_; }
+        [[nodiscard]] auto begin() const noexcept -> ElementType* { return elements_; }
+        [[nodiscard]] auto end() const noexcept -> ElementType* { return elements_ + size_; }
+        [[nodiscard]] auto data() const noexcept -> ElementType* { return elements_; }
+        [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+    private:
+        static auto Length(JArrayType array, JNIEnv* env) -> std::size_t {
+            assert(detail::jni::critical_depth_ == 0 && 
+                   "GetArrayLength inside a CriticalView; pass the length explicitly");
+            return static_cast<std::size_t>(env->GetArrayLength(array));
+        }
+
+        JNIEnv* env_;
+        JArrayType array_;
+        std::size_t size_;
+        ElementType* elements_;
+    };
+
+    template<typename JArrayType, typename ElementType, typename ThreadingPolicy>
+    CriticalView(detail::JPrimitiveArray<JArrayType, ElementType, ThreadingPolicy> const&) 
+        -> CriticalView<std::add_const_t<ElementType>>;
+
+    template<typename JArrayType, typename ElementType, typename ThreadingPolicy>
+    CriticalView(detail::JPrimitiveArray<JArrayType, ElementType, ThreadingPolicy> const&, JNIEnv*) 
+        -> CriticalView<std::add_const_t<ElementType>>;
+
+#define JBRIDGE_CRITICAL_VIEW_GUIDE(element) \
+    CriticalView(traits::primitive_array_t<element>) -> CriticalView<element>; \
+    CriticalView(traits::primitive_array_t<element>, JNIEnv*) -> CriticalView<element>; \
+    CriticalView(traits::primitive_array_t<element>, std::size_t) -> CriticalView<element>; \
+    CriticalView(traits::primitive_array_t<element>, std::size_t, JNIEnv*) -> CriticalView<element>;
+
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jboolean)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jbyte)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jchar)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jshort)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jint)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jlong)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jfloat)
+    JBRIDGE_CRITICAL_VIEW_GUIDE(jdouble)
+
+#undef JBRIDGE_CRITICAL_VIEW_GUIDE
+
+    // ============================================================================
+    // SIMD Kernels (detail::simd)
+    // ============================================================================
+
+    namespace detail::simd {
+
+        // Per-element-type vector operations; disabled types fall back to scalar loops
+        template<typename T>
+        struct ops {
+            static constexpr bool enabled = false;
+        };
+
+#if defined(JBRIDGE_ALGO_AVX2)
+
+        template<> struct ops<jfloat> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 8;
+            using reg = __m256;
+            static auto load(const jfloat* p) noexcept -> reg { return _mm256_loadu_ps(p); }
+            static void store(jfloat* p, reg v) noexcept { _mm256_storeu_ps(p, v); }
+            static auto set1(jfloat v) noexcept -> reg { return _mm256_set1_ps(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return _mm256_add_ps(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return _mm256_mul_ps(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return _mm256_min_ps(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return _mm256_max_ps(a, b); }
+        };
+
+        template<> struct ops<jdouble> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 4;
+            using reg = __m256d;
+            static auto load(const jdouble* p) noexcept -> reg { return _mm256_loadu_pd(p); }
+            static void store(jdouble* p, reg v) noexcept { _mm256_storeu_pd(p, v); }
+            static auto set1(jdouble v) noexcept -> reg { return _mm256_set1_pd(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return _mm256_add_pd(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return _mm256_mul_pd(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return _mm256_min_pd(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return _mm256_max_pd(a, b); }
+        };
+
+        template<> struct ops<jint> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 8;
+            using reg = __m256i;
+            static auto load(const jint* p) noexcept -> reg { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static void store(jint* p, reg v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+            static auto set1(jint v) noexcept -> reg { return _mm256_set1_epi32(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return _mm256_add_epi32(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return _mm256_mullo_epi32(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return _mm256_min_epi32(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return _mm256_max_epi32(a, b); }
+        };
+
+#elif defined(JBRIDGE_ALGO_SSE2)
+
+        template<> struct ops<jfloat> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 4;
+            using reg = __m128;
+            static auto load(const jfloat* p) noexcept -> reg { return _mm_loadu_ps(p); }
+            static void store(jfloat* p, reg v) noexcept { _mm_storeu_ps(p, v); }
+            static auto set1(jfloat v) noexcept -> reg { return _mm_set1_ps(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return _mm_add_ps(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return _mm_mul_ps(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return _mm_min_ps(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return _mm_max_ps(a, b); }
+        };
+
+        template<> struct ops<jdouble> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 2;
+            using reg = __m128d;
+            static auto load(const jdouble* p) noexcept -> reg { return _mm_loadu_pd(p); }
+            static void store(jdouble* p, reg v) noexcept { _mm_storeu_pd(p, v); }
+            static auto set1(jdouble v) noexcept -> reg { return _mm_set1_pd(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return _mm_add_pd(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return _mm_mul_pd(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return _mm_min_pd(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return _mm_max_pd(a, b); }
+        };
+
+#if defined(__SSE4_1__)
+        // 32-bit multiply/min/max need SSE4.1
+        template<> struct ops<jint> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 4;
+            using reg = __m128i;
+            static auto load(const jint* p) noexcept -> reg { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store(jint* p, reg v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static auto set1(jint v) noexcept -> reg { return _mm_set1_epi32(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return _mm_add_epi32(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return _mm_mullo_epi32(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return _mm_min_epi32(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return _mm_max_epi32(a, b); }
+        };
+#endif
+
+#elif defined(JBRIDGE_ALGO_NEON)
+
+        template<> struct ops<jfloat> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 4;
+            using reg = float32x4_t;
+            static auto load(const jfloat* p) noexcept -> reg { return vld1q_f32(p); }
+            static void store(jfloat* p, reg v) noexcept { vst1q_f32(p, v); }
+            static auto set1(jfloat v) noexcept -> reg { return vdupq_n_f32(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return vaddq_f32(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return vmulq_f32(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return vminq_f32(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return vmaxq_f32(a, b); }
+        };
+
+        template<> struct ops<jint> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 4;
+            using reg = int32x4_t;
+            static auto load(const jint* p) noexcept -> reg { return vld1q_s32(p); }
+            static void store(jint* p, reg v) noexcept { vst1q_s32(p, v); }
+            static auto set1(jint v) noexcept -> reg { return vdupq_n_s32(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return vaddq_s32(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return vmulq_s32(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return vminq_s32(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return vmaxq_s32(a, b); }
+        };
+
+#if defined(__aarch64__)
+        template<> struct ops<jdouble> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t lanes = 2;
+            using reg = float64x2_t;
+            static auto load(const jdouble* p) noexcept -> reg { return vld1q_f64(p); }
+            static void store(jdouble* p, reg v) noexcept { vst1q_f64(p, v); }
+            static auto set1(jdouble v) noexcept -> reg { return vdupq_n_f64(v); }
+            static auto add(reg a, reg b) noexcept -> reg { return vaddq_f64(a, b); }
+            static auto mul(reg a, reg b) noexcept -> reg { return vmulq_f64(a, b); }
+            static auto min(reg a, reg b) noexcept -> reg { return vminq_f64(a, b); }
+            static auto max(reg a, reg b) noexcept -> reg { return vmaxq_f64(a, b); }
+        };
+#endif
+
+#endif
+
+        template<typename T>
+        inline constexpr bool kVectorized = ops<T>::enabled;
+
+        // Floating sums accumulate per block before widening to keep rounding bounded
+        inline constexpr std::size_t kSumBlockVectors = 256;
+
+        template<typename T>
+        using sum_t = std::conditional_t<std::is_floating_point_v<T>, jdouble, jlong>;
+
+        template<typename T, typename Op>
+        [[nodiscard]] auto FoldLanes(typename ops<T>::reg v, T init, Op op) noexcept -> T {
+            alignas(64) T lanes[ops<T>::lanes];
+            ops<T>::store(lanes, v);
+            for (auto lane : lanes) {
+                init = op(init, lane);
+            }
+            return init;
+        }
+
+        // Java semantics: integer arithmetic wraps instead of overflowing
+        template<typename T>
+        [[nodiscard]] constexpr auto WrappingMul(T a, T b) noexcept -> T {
+            if constexpr (std::is_integral_v<T>) {
+                using Wide = std::conditional_t<(sizeof(T) > 4), std::uint64_t, std::uint32_t>;
+                return static_cast<T>(static_cast<Wide>(a) * static_cast<Wide>(b));
+            } else {
+                return a * b;
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] auto Sum(const T* p, std::size_t n) noexcept -> sum_t<T> {
+            std::size_t i = 0;
+
+            if constexpr (std::is_floating_point_v<T>) {
+                sum_t<T> total{};
+                if constexpr (kVectorized<T>) {
+                    using V = ops<T>;
+                    while (n - i >= V::lanes) {
+                        auto block_end = i + std::min(kSumBlockVectors, (n - i) / V::lanes) * V::lanes;
+                        auto acc = V::set1(T{});
+                        for (; i < block_end; i += V::lanes) {
+                            acc = V::add(acc, V::load(p + i));
+                        }
+                        total += FoldLanes<T>(acc, T{}, std::plus<>{});
+                    }
+                }
+                for (; i < n; ++i) {
+                    total += p[i];
+                }
+                return total;
+            } else {
+                std::uint64_t total = 0;
+                for (; i < n; ++i) {
+                    total += static_cast<std::uint64_t>(static_cast<sum_t<T>>(p[i]));
+                }
+                return static_cast<sum_t<T>>(total);
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] auto Dot(const T* a, const T* b, std::size_t n) noexcept -> sum_t<T> {
+            std::size_t i = 0;
+
+            if constexpr (std::is_floating_point_v<T>) {
+                sum_t<T> total{};
+                if constexpr (kVectorized<T>) {
+                    using V = ops<T>;
+                    while (n - i >= V::lanes) {
+                        auto block_end = i + std::min(kSumBlockVectors, (n - i) / V::lanes) * V::lanes;
+                        auto acc = V::set1(T{});
+                        for (; i < block_end; i += V::lanes) {
+                            acc = V::add(acc, V::mul(V::load(a + i), V::load(b + i)));
+                        }
+                        total += FoldLanes<T>(acc, T{}, std::plus<>{});
+                    }
+                }
+                for (; i < n; ++i) {
+                    total += static_cast<sum_t<T>>(a[i] * b[i]);
+                }
+                return total;
+            } else {
+                std::uint64_t total = 0;
+                for (; i < n; ++i) {
+                    total += static_cast<std::uint64_t>(static_cast<sum_t<T>>(a[i])) * 
+                             static_cast<std::uint64_t>(static_cast<sum_t<T>>(b[i]));
+                }
+                return static_cast<sum_t<T>>(total);
+            }
+        }
+
+        // Requires n > 0
+        template<typename T>
+        [[nodiscard]] auto MinMax(const T* p, std::size_t n) noexcept -> std::pair<T, T> {
+            T lo = p[0];
+            T hi = p[0];
+            std::size_t i = 0;
+
+            if constexpr (kVectorized<T>) {
+                using V = ops<T>;
+                if (n >= V::lanes) {
+                    auto vlo = V::load(p);
+                    auto vhi = vlo;
+                    for (i = V::lanes; i + V::lanes <= n; i += V::lanes) {
+                        auto v = V::load(p + i);
+                        vlo = V::min(vlo, v);
+                        vhi = V::max(vhi, v);
+                    }
+                    lo = FoldLanes<T>(vlo, lo, [](T x, T y) { return std::min(x, y); });
+                    hi = FoldLanes<T>(vhi, hi, [](T x, T y) { return std::max(x, y); });
+                }
+            }
+            for (; i < n; ++i) {
+                lo = std::min(lo, p[i]);
+                hi = std::max(hi, p[i]);
+            }
+            return {lo, hi};
+        }
+
+        template<typename T>
+        void Scale(T* p, std::size_t n, T factor) noexcept {
+            std::size_t i = 0;
+
+            if constexpr (kVectorized<T>) {
+                using V = ops<T>;
+                auto vf = V::set1(factor);
+                for (; i + V::lanes <= n; i += V::lanes) {
+                    V::store(p + i, V::mul(V::load(p + i), vf));
+                }
+            }
+            for (; i < n; ++i) {
+                p[i] = WrappingMul(p[i], factor);
+            }
+        }
+
+        template<typename T>
+        void Clamp(T* p, std::size_t n, T lo, T hi) noexcept {
+            std::size_t i = 0;
+
+            if constexpr (kVectorized<T>) {
+                using V = ops<T>;
+                auto vlo = V::set1(lo);
+                auto vhi = V::set1(hi);
+                // x86 min/max return the second operand when either is NaN; putting x last
+                // passes NaN through like the std::clamp tail does
+                for (; i + V::lanes <= n; i += V::lanes) {
+                    V::store(p + i, V::min(vhi, V::max(vlo, V::load(p + i))));
+                }
+            }
+            for (; i < n; ++i) {
+                p[i] = std::clamp(p[i], lo, hi);
+            }
+        }
+
+        // Returns n when not found
+        [[nodiscard]] inline auto FindByte(const jbyte* p, std::size_t n, jbyte value) noexcept -> std::size_t {
+            std::size_t i = 0;
+
+#if defined(JBRIDGE_ALGO_AVX2)
+            auto needle = _mm256_set1_epi8(value);
+            for (; i + 32 <= n; i += 32) {
+                auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+                if (mask)
+                    return i + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+#elif defined(JBRIDGE_ALGO_SSE2)
+            auto needle = _mm_set1_epi8(value);
+            for (; i + 16 <= n; i += 16) {
+                auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+                if (mask)
+                    return i + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+#elif defined(JBRIDGE_ALGO_NEON)
+            auto needle = vdupq_n_s8(value);
+            for (; i + 16 <= n; i += 16) {
+                auto eq = vceqq_s8(vld1q_s8(p + i), needle);
+                // Narrow to 4 bits per byte to get a scalar mask
+                auto mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+                if (mask)
+                    return i + static_cast<std::size_t>(std::countr_zero(mask)) / 4;
+            }
+#endif
+            for (; i < n; ++i) {
+                if (p[i] == value)
+                    return i;
+            }
+            return n;
+        }
+
+        inline constexpr std::uint32_t kAdlerBase = 65521;
+
+        // Largest block for which 32-bit Adler sums cannot overflow
+        inline constexpr std::size_t kAdlerBlock = 5552;
+
+        [[nodiscard]] inline auto Adler32(const jbyte* p, std::size_t n, std::uint32_t adler = 1) noexcept -> std::uint32_t {
+            std::uint32_t a = adler & 0xFFFF;
+            std::uint32_t b = adler >> 16;
+
+            while (n > 0) {
+                auto block = std::min(n, kAdlerBlock);
+                n -= block;
+                for (; block >= 8; block -= 8, p += 8) {
+                    for (std::size_t k = 0; k < 8; ++k) {
+                        a += static_cast<std::uint8_t>(p[k]);
+                        b += a;
+                    }
+                }
+                for (; block > 0; --block, ++p) {
+                    a += static_cast<std::uint8_t>(*p);
+                    b += a;
+                }
+                a %= kAdlerBase;
+                b %= kAdlerBase;
+            }
+            return (b << 16) | a;
+        }
+
+        // Checksum of A||B from the checksums of A and B (zlib adler32_combine)
+        [[nodiscard]] inline auto Adler32Combine(std::uint32_t adler1, std::uint32_t adler2, 
+                                                 std::size_t len2) noexcept -> std::uint32_t {
+            auto rem = static_cast<std::uint32_t>(len2 % kAdlerBase);
+            std::uint32_t sum1 = adler1 & 0xFFFF;
+            std::uint32_t sum2 = (rem * sum1) % kAdlerBase;
+            sum1 += (adler2 & 0xFFFF) + kAdlerBase - 1;
+            sum2 += ((adler1 >> 16) & 0xFFFF) + ((adler2 >> 16) & 0xFFFF) + kAdlerBase - rem;
+            if (sum1 >= kAdlerBase) sum1 -= kAdlerBase;
+            if (sum1 >= kAdlerBase) sum1 -= kAdlerBase;
+            if (sum2 >= (kAdlerBase << 1)) sum2 -= (kAdlerBase << 1);
+            if (sum2 >= kAdlerBase) sum2 -= kAdlerBase;
+            return sum1 | (sum2 << 16);
+        }
+
+    } // namespace detail::simd
+
+    // ============================================================================
+    // Algorithms: Kernels over pinned primitive arrays (jb::algo)
+    // ============================================================================
+
+    namespace algo {
+
+        // Selects the parallel variant of a kernel
+        struct Parallel {
+            std::size_t threads = 0;                // 0: std::thread::hardware_concurrency()
+            std::size_t min_chunk = 1 << 16;        // Minimum elements per thread
+        };
+
+        inline constexpr Parallel par{};
+
+        template<typename R>
+        concept NumericRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                               std::is_arithmetic_v<std::ranges::range_value_t<R>>;
+
+        template<typename R>
+        concept ByteRange = NumericRange<R> && std::same_as<std::ranges::range_value_t<R>, jbyte>;
+
+        template<typename R>
+        using value_t = std::ranges::range_value_t<R>;
+
+    } // namespace algo
+
+    namespace detail::algo {
+
+        [[nodiscard]] inline auto WorkerCount(jb::algo::Parallel policy, std::size_t n) -> std::size_t {
+            std::size_t threads = policy.threads ? policy.threads : std::thread::hardware_concurrency();
+            std::size_t by_size = n / std::max<std::size_t>(policy.min_chunk, 1);
+            return std::max<std::size_t>(1, std::min(threads, by_size));
+        }
+
+        // Runs chunk(begin, end) on contiguous slices and folds results left to right
+        template<typename Chunk, typename Combine>
+        [[nodiscard]] auto ParallelReduce(jb::algo::Parallel policy, std::size_t n, Chunk chunk, Combine combine) {
+            using Result = std::invoke_result_t<Chunk, std::size_t, std::size_t>;
+
+            auto workers = WorkerCount(policy, n);
+            auto step = n / workers;
+
+            std::vector<std::future<Result>> parts;
+            parts.reserve(workers - 1);
+            for (std::size_t w = 1; w < workers; ++w) {
+                auto begin = w * step;
+                auto end = (w + 1 == workers) ? n : begin + step;
+                parts.push_back(std::async(std::launch::async, chunk, begin, end));
+            }
+
+            Result result = chunk(0, workers == 1 ? n : step);
+            for (auto& part : parts) {
+                result = combine(std::move(result), part.get());
+            }
+            return result;
+        }
+
+        template<typename Chunk>
+        void ParallelFor(jb::algo::Parallel policy, std::size_t n, Chunk chunk) {
+            auto result = ParallelReduce(policy, n, [&chunk](std::size_t begin, std::size_t end) {
+                chunk(begin, end);
+                return true;
+            }, [](bool, bool) { return true; });
+            (void)result;
+        }
+
+    } // namespace detail::algo
+
+    namespace algo {
+
+        // Sum; integers widen to jlong (wrapping), floating types to jdouble
+        template<NumericRange R>
+        [[nodiscard]] auto Sum(R const& values) {
+            std::span<const value_t<R>> v(values);
+            return detail::simd::Sum(v.data(), v.size());
+        }
+
+        template<NumericRange R>
+        [[nodiscard]] auto Sum(Parallel policy, R const& values) {
+            std::span<const value_t<R>> v(values);
+            return detail::algo::ParallelReduce(policy, v.size(), [v](std::size_t begin, std::size_t end) {
+                return detail::simd::Sum(v.data() + begin, end - begin);
+            }, std::plus<>{});
+        }
+
+        template<NumericRange R1, NumericRange R2>
+            requires std::same_as<value_t<R1>, value_t<R2>>
+        [[nodiscard]] auto Dot(R1 const& lhs, R2 const& rhs) {
+            std::span<const value_t<R1>> a(lhs);
+            std::span<const value_t<R2>> b(rhs);
+            if (a.size() != b.size())
+                throw std::invalid_argument("algo::Dot(): size mismatch");
+
+            return detail::simd::Dot(a.data(), b.data(), a.size());
+        }
+
+        template<NumericRange R1, NumericRange R2>
+            requires std::same_as<value_t<R1>, value_t<R2>>
+        [[nodiscard]] auto Dot(Parallel policy, R1 const& lhs, R2 const& rhs) {
+            std::span<const value_t<R1>> a(lhs);
+            std::span<const value_t<R2>> b(rhs);
+            if (a.size() != b.size())
+                throw std::invalid_argument("algo::Dot(): size mismatch");
+
+            return detail::algo::ParallelReduce(policy, a.size(), [a, b](std::size_t begin, std::size_t end) {
+                return detail::simd::Dot(a.data() + begin, b.data() + begin, end - begin);
+            }, std::plus<>{});
+        }
+
+        // NaN ordering is unspecified
+        template<NumericRange R>
+        [[nodiscard]] auto MinMax(R const& values) -> std::optional<std::pair<value_t<R>, value_t<R>>> {
+            std::span<const value_t<R>> v(values);
+            if (v.empty())
+                return std::nullopt;
+
+            return detail::simd::MinMax(v.data(), v.size());
+        }
+
+        template<NumericRange R>
+        [[nodiscard]] auto MinMax(Parallel policy, R const& values) -> std::optional<std::pair<value_t<R>, value_t<R>>> {
+            std::span<const value_t<R>> v(values);
+            if (v.empty())
+                return std::nullopt;
+
+            return detail::algo::ParallelReduce(policy, v.size(), [v](std::size_t begin, std::size_t end) {
+                return detail::simd::MinMax(v.data() + begin, end - begin);
+            }, [](auto lhs, auto rhs) {
+                return std::pair{std::min(lhs.first, rhs.first), std::max(lhs.second, rhs.second)};
+            });
+        }
+
+        template<NumericRange R>
+        [[nodiscard]] auto Min(R const& values) -> std::optional<value_t<R>> {
+            auto result = MinMax(values);
+            return result ? std::optional{result->first} : std::nullopt;
+        }
+
+        template<NumericRange R>
+        [[nodiscard]] auto Min(Parallel policy, R const& values) -> std::optional<value_t<R>> {
+            auto result = MinMax(policy, values);
+            return result ? std::optional{result->first} : std::nullopt;
+        }
+
+        template<NumericRange R>
+        [[nodiscard]] auto Max(R const& values) -> std::optional<value_t<R>> {
+            auto result = MinMax(values);
+            return result ? std::optional{result->second} : std::nullopt;
+        }
+
+        template<NumericRange R>
+        [[nodiscard]] auto Max(Parallel policy, R const& values) -> std::optional<value_t<R>> {
+            auto result = MinMax(policy, values);
+            return result ? std::optional{result->second} : std::nullopt;
+        }
+
+        // In place; integer products wrap like Java
+        template<NumericRange R>
+        void Scale(R&& values, value_t<R> factor) {
+            std::span v(values);
+            detail::simd::Scale(v.data(), v.size(), factor);
+        }
+
+        template<NumericRange R>
+        void Scale(Parallel policy, R&& values, value_t<R> factor) {
+            std::span v(values);
+            detail::algo::ParallelFor(policy, v.size(), [v, factor](std::size_t begin, std::size_t end) {
+                detail::simd::Scale(v.data() + begin, end - begin, factor);
+            });
+        }
+
+        template<NumericRange R>
+        void Clamp(R&& values, value_t<R> lo, value_t<R> hi) {
+            if (hi < lo)
+                throw std::invalid_argument("algo::Clamp(): lo is greater than hi");
+
+            std::span v(values);
+            detail::simd::Clamp(v.data(), v.size(), lo, hi);
+        }
+
+        template<NumericRange R>
+        void Clamp(Parallel policy, R&& values, value_t<R> lo, value_t<R> hi) {
+            if (hi < lo)
+                throw std::invalid_argument("algo::Clamp(): lo is greater than hi");
+
+            std::span v(values);
+            detail::algo::ParallelFor(policy, v.size(), [v, lo, hi](std::size_t begin, std::size_t end) {
+                detail::simd::Clamp(v.data() + begin, end - begin, lo, hi);
+            });
+        }
+
+        // Index of the first byte equal to value
+        template<ByteRange R>
+        [[nodiscard]] auto Find(R const& bytes, jbyte value) -> std::optional<std::size_t> {
+            std::span<const jbyte> v(bytes);
+            auto index = detail::simd::FindByte(v.data(), v.size(), value);
+            return index == v.size() ? std::nullopt : std::optional{index};
+        }
+
+        template<ByteRange R>
+        [[nodiscard]] auto Find(Parallel policy, R const& bytes, jbyte value) -> std::optional<std::size_t> {
+            std::span<const jbyte> v(bytes);
+            auto n = v.size();
+            auto index = detail::algo::ParallelReduce(policy, n, [v, value](std::size_t begin, std::size_t end) {
+                auto found = detail::simd::FindByte(v.data() + begin, end - begin, value);
+                return found == end - begin ? v.size() : begin + found;
+            }, [n](std::size_t lhs, std::size_t rhs) {
+                return lhs != n ? lhs : rhs;
+            });
+            return index == n ? std::nullopt : std::optional{index};
+        }
+
+        // Adler-32, identical to java.util.zip.Adler32
+        template<ByteRange R>
+        [[nodiscard]] auto Checksum(R const& bytes) -> std::uint32_t {
+            std::span<const jbyte> v(bytes);
+            return detail::simd::Adler32(v.data(), v.size());
+        }
+
+        template<ByteRange R>
+        [[nodiscard]] auto Checksum(Parallel policy, R const& bytes) -> std::uint32_t {
+            std::span<const jbyte> v(bytes);
+            auto result = detail::algo::ParallelReduce(policy, v.size(), [v](std::size_t begin, std::size_t end) {
+                return std::pair{detail::simd::Adler32(v.data() + begin, end - begin), end - begin};
+            }, [](auto lhs, auto rhs) {
+                return std::pair{detail::simd::Adler32Combine(lhs.first, rhs.first, rhs.second), lhs.second + rhs.second};
+            });
+            return result.first;
+        }
+
+    } // namespace algo
+
+    // ============================================================================
+    // UTF-16 -> UTF-8 Transcoder (detail::simd)
+    // ============================================================================
+
+    namespace detail::simd {
+
+        // Worst case output: 3 bytes per UTF-16 unit
+        inline constexpr std::size_t kUtf8PerUtf16 = 3;
+
+        // Encodes one code point at src[i]; returns consumed units. Lone surrogates become U+FFFD.
+        [[nodiscard]] inline auto EncodeUtf8(const jchar* src, std::size_t i, std::size_t n, 
+                                             char* out, std::size_t& o) noexcept -> std::size_t {
+            auto put = [&](std::uint32_t byte) { out[o++] = static_cast<char>(byte); };
+            std::uint32_t c = src[i];
+
+            if (c < 0x80) {
+                put(c);
+                return 1;
+            }
+            if (c < 0x800) {
+                put(0xC0 | (c >> 6));
+                put(0x80 | (c & 0x3F));
+                return 1;
+            }
+            if (c >= 0xD800 && c <= 0xDBFF && i + 1 < n && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+                std::uint32_t cp = 0x10000 + ((c - 0xD800) << 10) + (src[i + 1] - 0xDC00u);
+                put(0xF0 | (cp >> 18));
+                put(0x80 | ((cp >> 12) & 0x3F));
+                put(0x80 | ((cp >> 6) & 0x3F));
+                put(0x80 | (cp & 0x3F));
+                return 2;
+            }
+            if (c >= 0xD800 && c <= 0xDFFF) {
+                c = 0xFFFD;
+            }
+            put(0xE0 | (c >> 12));
+            put(0x80 | ((c >> 6) & 0x3F));
+            put(0x80 | (c & 0x3F));
+            return 1;
+        }
+
+        // Standard UTF-8 (unlike JNI's modified UTF-8). out needs n * kUtf8PerUtf16 bytes; returns bytes written.
+        [[nodiscard]] inline auto Utf16ToUtf8(const jchar* src, std::size_t n, char* out) noexcept -> std::size_t {
+            constexpr std::size_t kBlock = 8;
+            std::size_t i = 0;
+            std::size_t o = 0;
+
+            while (i < n) {
+                // ASCII fast path: narrow 8 units at once
+                if (i + kBlock <= n) {
+#if defined(JBRIDGE_ALGO_AVX2) || defined(JBRIDGE_ALGO_SSE2)
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto non_ascii = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80)));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, _mm_setzero_si128())) == 0xFFFF) {
+                        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + o), _mm_packus_epi16(v, v));
+                        i += kBlock;
+                        o += kBlock;
+                        continue;
+                    }
+#elif defined(JBRIDGE_ALGO_NEON)
+                    auto v = vld1q_u16(src + i);
+                    // Saturating shift keeps any unit >= 0x80 non-zero
+                    if (vget_lane_u64(vreinterpret_u64_u8(vqshrn_n_u16(v, 7)), 0) == 0) {
+                        vst1_u8(reinterpret_cast<std::uint8_t*>(out + o), vmovn_u16(v));
+                        i += kBlock;
+                        o += kBlock;
+                        continue;
+                    }
+#endif
+                }
+
+                for (auto stop = std::min(i + kBlock, n); i < stop;) {
+                    i += EncodeUtf8(src, i, n, out, o);
+                }
+            }
+            return o;
+        }
+
+    } // namespace detail::simd
+
+    // ============================================================================
+    // String Conversion: jstring -> C++ strings without VM-side allocation
+    // ============================================================================
+
+    namespace detail::jni {
+
+        // Stack storage for short strings, heap only past N elements
+        template<typename T, std::size_t N>
+        class SmallBuffer {
+        public:
+            explicit SmallBuffer(std::size_t size) 
+                : data_(size <= N ? stack_ : (heap_ = std::make_unique_for_overwrite<T[]>(size)).get()) {}
+
+            SmallBuffer(SmallBuffer const&) = delete;
+            SmallBuffer& operator=(SmallBuffer const&) = delete;
+
+            [[nodiscard]] auto data() noexcept -> T* { return data_; }
+
+        private:
+            T stack_[N];
+            std::unique_ptr<T[]> heap_;
+            T* data_;
+        };
+
+        inline constexpr std::size_t kStringStackUnits = 256;
+
+    } // namespace detail::jni
+
+    // Calls visitor(std::string_view) with the string's bytes, backed by a stack buffer for short strings
+    template<typename Visitor>
+    decltype(auto) VisitString(jstring str, Visitor&& visitor, 
+                               Utf8Mode mode = Utf8Mode::Modified, JNIEnv* env = detail::jni::GetEnv()) {
+        using namespace detail::jni;
+
+        if (!str)
+            return std::forward<Visitor>(visitor)(std::string_view{});
+
+        auto length = env->GetStringLength(str);
+
+        if (mode == Utf8Mode::Modified) {
+            auto utf_length = static_cast<std::size_t>(env->GetStringUTFLength(str));
+            SmallBuffer<char, kStringStackUnits * 2> buffer(utf_length + 1);
+            env->GetStringUTFRegion(str, 0, length, buffer.data());
+            return std::forward<Visitor>(visitor)(std::string_view{buffer.data(), utf_length});
+        } else {
+            auto units = static_cast<std::size_t>(length);
+            SmallBuffer<jchar, kStringStackUnits> utf16(units);
+            env->GetStringRegion(str, 0, length, utf16.data());
+
+            SmallBuffer<char, kStringStackUnits * detail::simd::kUtf8PerUtf16> utf8(units * detail::simd::kUtf8PerUtf16);
+            auto size = detail::simd::Utf16ToUtf8(utf16.data(), units, utf8.data());
+            return std::forward<Visitor>(visitor)(std::string_view{utf8.data(), size});
+        }
+    }
+
+    inline auto ToStdString(jstring str, Utf8Mode mode, JNIEnv* env) -> std::string {
+        if (!str)
+            return {};
+
+        auto length = env->GetStringLength(str);
+        std::string result;
+
+        if (mode == Utf8Mode::Modified) {
+            // Written straight into the string: short strings stay in its inline storage
+            result.resize(static_cast<std::size_t>(env->GetStringUTFLength(str)));
+            env->GetStringUTFRegion(str, 0, length, result.data());
+        } else {
+            auto units = static_cast<std::size_t>(length);
+            detail::jni::SmallBuffer<jchar, detail::jni::kStringStackUnits> utf16(units);
+            env->GetStringRegion(str, 0, length, utf16.data());
+
+            result.resize(units * detail::simd::kUtf8PerUtf16);
+            result.resize(detail::simd::Utf16ToUtf8(utf16.data(), units, result.data()));
+        }
+        return result;
+    }
+
+    [[nodiscard]] inline auto ToU16String(jstring str, JNIEnv* env = detail::jni::GetEnv()) -> std::u16string {
+        if (!str)
+            return {};
+
+        auto length = env->GetStringLength(str);
+        std::u16string result(static_cast<std::size_t>(length), u'\0');
+        static_assert(sizeof(char16_t) == sizeof(jchar));
+        env->GetStringRegion(str, 0, length, reinterpret_cast<jchar*>(result.data()));
+        return result;
+    }
+
+    // ============================================================================
+    // Native Binding: C++ functions registered as Java native methods
+    // ============================================================================
+
+    namespace detail::jni {
+
+        // C++ parameter/return type of a bound native -> Java type (for the signature) and JNI type
+        template<typename T>
+        struct native_type;
+
+        template<typename T>
+            requires std::is_void_v<T> || concepts::JniPrimitive<T>
+        struct native_type<T> {
+            using java_type = T;
+            using jni_type = std::conditional_t<std::is_void_v<T>, void, box_value_t<T>>;
+        };
+
+        template<concepts::DerivedFromJBase T>
+        struct native_type<T> {
+            using java_type = T;
+            using jni_type = jobject;
+        };
+
+        template<concepts::JniObjectType T>
+        struct native_type<T> {
+            using java_type = T;
+            using jni_type = T;
+        };
+
+        template<>
+        struct native_type<std::string> {
+            using java_type = jstring;
+            using jni_type = jstring;
+        };
+
+        template<typename JArrayType, typename ElementType, typename ThreadingPolicy>
+        struct native_type<JPrimitiveArray<JArrayType, ElementType, ThreadingPolicy>> {
+            using java_type = JArrayType;
+            using jni_type = JArrayType;
+        };
+
+        template<typename Mirror, typename ThreadingPolicy>
+        struct native_type<JObjectArray<Mirror, ThreadingPolicy>> {
+            using java_type = Mirror[];
+            using jni_type = jobjectArray;
+        };
+
+        template<typename ElementType>
+        struct native_type<JDirectBuffer<ElementType>> {
+            using java_type = JDirectBuffer<ElementType>;
+            using jni_type = jobject;
+        };
+
+        template<typename T>
+        using native_java_t = typename native_type<std::remove_cvref_t<T>>::java_type;
+
+        template<typename T>
+        using native_jni_t = typename native_type<std::remove_cvref_t<T>>::jni_type;
+
+        template<typename T>
+        [[nodiscard]] inline auto FromNative(JNIEnv* env, native_jni_t<T> value) -> std::remove_cvref_t<T> {
+            using ArgType = std::remove_cvref_t<T>;
+
+            if constexpr (std::same_as<ArgType, bool>) {
+                return value != JNI_FALSE;
+            } else if constexpr (concepts::JniPrimitive<ArgType>) {
+                return static_cast<ArgType>(value);
+            } else if constexpr (std::same_as<ArgType, std::string>) {
+                return ToStdString(value, Utf8Mode::Modified, env);
+            } else if constexpr (concepts::JniObjectType<ArgType>) {
+                return value;
+            } else {
+                return ArgType{value};
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto ToNative(JNIEnv* env, T&& value) -> native_jni_t<T> {
+            using ArgType = std::remove_cvref_t<T>;
+
+            if constexpr (concepts::JniPrimitive<ArgType>) {
+                return ToBoxValue(value);
+            } else if constexpr (std::same_as<ArgType, std::string>) {
+                return env->NewStringUTF(value.c_str());
+            } else if constexpr (concepts::DerivedFromJBase<ArgType>) {
+                return value.GetObject();
+            } else if constexpr (concepts::JniObjectType<ArgType>) {
+                return value;
+            } else {
+                return static_cast<native_jni_t<T>>(value.Raw());
+            }
+        }
+
+        // C++ exceptions must not unwind through the VM: a JavaException rethrows its throwable,
+        // anything else becomes java.lang.RuntimeException
+        template<typename ReturnType, typename Call>
+        [[nodiscard]] inline auto InvokeNative(JNIEnv* env, Call&& call) -> native_jni_t<ReturnType> {
+            try {
+                if constexpr (std::is_void_v<ReturnType>) {
+                    call();
+                } else {
+                    return ToNative(env, call());
+                }
+            } catch (JavaException const& e) {
+                e.Rethrow(env);
+            } catch (std::exception const& e) {
+                env->ThrowNew(FindCachedClass<str::arrayify("java/lang/RuntimeException")>(), e.what());
+            } catch (...) {
+                env->ThrowNew(FindCachedClass<str::arrayify("java/lang/RuntimeException")>(), "unknown C++ exception");
+            }
+
+            if constexpr (!std::is_void_v<ReturnType>) {
+                return {};
+            }
+        }
+
+        template<bool IsStatic, auto Fn, typename = decltype(Fn)>
+        struct NativeThunk;
+
+        // Static native: the jclass receiver is dropped
+        template<auto Fn, typename ReturnType, typename ...ParameterTypes>
+        struct NativeThunk<Static, Fn, ReturnType (*)(ParameterTypes...)> {
+            static constexpr auto SIGNATURE =
+                tokenizer::build_function_signature<native_java_t<ReturnType>, native_java_t<ParameterTypes>...>();
+
+            static auto JNICALL Invoke(JNIEnv* env, jclass, native_jni_t<ParameterTypes>... args) -> native_jni_t<ReturnType> {
+                return InvokeNative<ReturnType>(env, [&]() -> ReturnType {
+                    return Fn(FromNative<ParameterTypes>(env, args)...);
+                });
+            }
+        };
+
+        // Instance native: the receiver is passed as Fn's first parameter (a mirror or jobject)
+        template<auto Fn, typename ReturnType, typename Self, typename ...ParameterTypes>
+        struct NativeThunk<NonStatic, Fn, ReturnType (*)(Self, ParameterTypes...)> {
+            static constexpr auto SIGNATURE =
+                tokenizer::build_function_signature<native_java_t<ReturnType>, native_java_t<ParameterTypes>...>();
+
+            static auto JNICALL Invoke(JNIEnv* env, jobject self, native_jni_t<ParameterTypes>... args) -> native_jni_t<ReturnType> {
+                return InvokeNative<ReturnType>(env, [&]() -> ReturnType {
+                    return Fn(FromNative<Self>(env, self), FromNative<ParameterTypes>(env, args)...);
+                });
+            }
+        };
+
+        struct NativeBinding {
+            const char* class_signature;
+            jclass (*find_class)();
+            JNINativeMethod method;
+        };
+
+        // Filled during static initialization by JBRIDGE_DEFINE_NATIVE
+        [[nodiscard]] inline auto NativeBindings() -> std::vector<NativeBinding>& {
+            static std::vector<NativeBinding> bindings;
+            return bindings;
+        }
+
+        template<bool IsStatic, typename Mirror, auto Fn>
+        inline auto BindNative(const char* name) -> bool {
+            using Thunk = NativeThunk<IsStatic, Fn>;
+
+            NativeBindings().push_back({
+                traits::class_signature_v<Mirror>.data(),
+                &FindCachedClass<traits::class_signature_v<Mirror>>,
+                JNINativeMethod{
+                    const_cast<char*>(name),
+                    const_cast<char*>(Thunk::SIGNATURE.data()),
+                    reinterpret_cast<void*>(&Thunk::Invoke)
+                }
+            });
+            return true;
+        }
+
+    } // namespace detail::jni
+
+    // Registers every JBRIDGE_DEFINE_NATIVE binding with one RegisterNatives call per class.
+    // Called by Init(); call it directly when natives are defined in a library loaded later.
+    inline void RegisterNatives(JNIEnv* env = detail::jni::GetEnv()) {
+        auto bindings = detail::jni::NativeBindings();
+        std::ranges::stable_sort(bindings, {}, [](auto const& binding) {
+            return std::string_view{binding.class_signature};
+        });
+
+        std::vector<JNINativeMethod> methods;
+        for (auto first = bindings.begin(); first != bindings.end();) {
+            auto last = std::find_if(first, bindings.end(), [&](auto const& binding) {
+                return std::string_view{binding.class_signature} != first->class_signature;
+            });
+
+            methods.clear();
+            for (auto it = first; it != last; ++it)
+                methods.push_back(it->method);
+
+            auto cls = first->find_class();
+            if (!cls)
+                throw std::runtime_error(std::string("RegisterNatives(): class not found: ") + first->class_signature);
+
+            if (env->RegisterNatives(cls, methods.data(), static_cast<jint>(methods.size())) != JNI_OK)
+                throw std::runtime_error(std::string("RegisterNatives(): failed for ") + first->class_signature);
+
+            first = last;
+        }
+    }
+
+    // ============================================================================
+    // Thread Attachment
+    // ============================================================================
+
+    // daemon: attach with AttachCurrentThreadAsDaemon. name: Java thread name (nullptr keeps the VM default).
+    using AttachOptions = detail::jni::AttachOptions;
+
+    // Attaches the calling thread with explicit options. GetEnv() attaches lazily with the defaults,
+    // so call this first on threads that need them. A thread that is already attached is left as is.
+    inline auto AttachCurrentThread(AttachOptions const& options = {}) noexcept -> JNIEnv* {
+        if (auto env = detail::jni::thread_env_)
+            return env;
+        return detail::jni::AttachThread(options);
+    }
+
+    // Detaches the calling thread now if JBridge attached it, and forgets its cached JNIEnv either way.
+    // Call it before detaching a thread through the VM directly.
+    inline void DetachCurrentThread() noexcept {
+        using namespace detail::jni;
+
+        if (thread_env_ && attachment_.owned) {
+            vm_->DetachCurrentThread();
+            attachment_.owned = false;
+        }
+        thread_env_ = nullptr;
+    }
+
+    // ============================================================================
+    // Executor: Pre-attached worker pool with work stealing
+    // ============================================================================
+
+    namespace detail {
+
+        // Move-only type-erased void() callable (std::function requires copyable targets)
+        class Task {
+        public:
+            Task() = default;
+
+            template<typename Fn>
+                requires (!std::same_as<std::remove_cvref_t<Fn>, Task>)
+            explicit Task(Fn&& fn) 
+                : callable_(std::make_unique<Callable<std::decay_t<Fn>>>(std::forward<Fn>(fn))) {}
+
+            void operator()() {
+                callable_->Invoke();
+            }
+
+            explicit operator bool() const noexcept {
+                return static_cast<bool>(callable_);
+            }
+
+        private:
+            struct CallableBase {
+                virtual ~CallableBase() = default;
+                virtual void Invoke() = 0;
+            };
+
+            template<typename Fn>
+            struct Callable final : CallableBase {
+                explicit Callable(Fn&& fn) : fn_(std::move(fn)) {}
+                explicit Callable(Fn const& fn) : fn_(fn) {}
+
+                void Invoke() override {
+                    fn_();
+                }
+
+                Fn fn_;
+            };
+
+            std::unique_ptr<CallableBase> callable_;
+        };
+
+    } // namespace detail
+
+    // Workers attach once at construction and stay attached until the executor is destroyed.
+    // Each task runs inside its own LocalFrame, and a Java exception left pending by a task is cleared.
+    class Executor {
+    public:
+        explicit Executor(std::size_t threads = std::max(1u, std::thread::hardware_concurrency()),
+                          AttachOptions options = {.daemon = false, .name = "jbridge-worker"},
+                          jint frame_capacity = 16)
+            : frame_capacity_(frame_capacity)
+        {
+            if (threads == 0)
+                throw std::invalid_argument("Executor: thread count must be non-zero");
+
+            for (std::size_t i = 0; i < threads; ++i)
+                queues_.push_back(std::make_unique<WorkQueue>());
+
+            std::latch attached(static_cast<std::ptrdiff_t>(threads));
+            workers_.reserve(threads);
+            try {
+                for (std::size_t i = 0; i < threads; ++i) {
+                    auto name = options.name ? std::string(options.name) + "-" + std::to_string(i) : std::string();
+                    workers_.emplace_back([this, i, options, name = std::move(name), &attached]() mutable {
+                        if (options.name)
+                            options.name = name.c_str();
+                        Run(i, options, attached);
+                    });
+                }
+            } catch (...) {
+                // Workers that did start never block on the latch, so they can be joined right away
+                Stop();
+                throw;
+            }
+            attached.wait();
+
+            if (attach_failed_.load()) {
+                Stop();
+                throw std::runtime_error("Executor: AttachCurrentThread() failed");
+            }
+        }
+
+        Executor(Executor const&) = delete;
+        Executor& operator=(Executor const&) = delete;
+
+        // Runs every task already submitted, then joins (and detaches) the workers
+        ~Executor() {
+            Stop();
+        }
+
+        template<typename Fn>
+            requires std::invocable<std::decay_t<Fn>&>
+        [[nodiscard]] auto Submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>&>> {
+            std::packaged_task<std::invoke_result_t<std::decay_t<Fn>&>()> task(std::forward<Fn>(fn));
+            auto future = task.get_future();
+            Push(detail::Task{std::move(task)});
+            return future;
+        }
+
+        // Fire-and-forget: fn must not throw
+        template<typename Fn>
+            requires std::invocable<std::decay_t<Fn>&>
+        void Post(Fn&& fn) {
+            Push(detail::Task{std::forward<Fn>(fn)});
+        }
+
+        [[nodiscard]] auto Size() const noexcept -> std::size_t {
+            return workers_.size();
+        }
+
+        // The executor whose worker is running the calling thread, or nullptr
+        [[nodiscard]] static auto Current() noexcept -> Executor* {
+            return current_;
+        }
+
+    private:
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<detail::Task> tasks;
+        };
+
+        // Called from a worker, the task goes to the back of its own queue; otherwise round-robin
+        void Push(detail::Task task) {
+            auto index = current_ == this 
+                ? current_index_ 
+                : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+            {
+                std::lock_guard lock(mutex_);
+                // Tasks may still fan out while the destructor drains the queues
+                if (stopping_ && current_ != this)
+                    throw std::logic_error("Executor::Submit(): executor is shutting down");
+
+                {
+                    std::lock_guard queue_lock(queues_[index]->mutex);
+                    queues_[index]->tasks.push_back(std::move(task));
+                }
+                ++pending_;
+            }
+            wakeup_.notify_one();
+        }
+
+        // Own queue from the back (LIFO), other queues from the front
+        auto TryTake(std::size_t index) -> detail::Task {
+            auto take = [this](WorkQueue& queue, bool own) -> detail::Task {
+                std::lock_guard lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return {};
+
+                detail::Task task;
+                if (own) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                } else {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            };
+
+            if (auto task = take(*queues_[index], true))
+                return task;
+
+            for (std::size_t k = 1; k < queues_.size(); ++k) {
+                if (auto task = take(*queues_[(index + k) % queues_.size()], false))
+                    return task;
+            }
+            return {};
+        }
+
+        void Stop() {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            wakeup_.notify_all();
+
+            for (auto& worker : workers_)
+                worker.join();
+        }
+
+        void Run(std::size_t index, AttachOptions const& options, std::latch& attached) {
+            auto env = AttachCurrentThread(options);
+            if (!env) {
+                // Reported by the constructor, which then stops the other workers
+                attach_failed_.store(true);
+                attached.count_down();
+                return;
+            }
+
+            current_ = this;
+            current_index_ = index;
+            attached.count_down();
+
+            for (;;) {
+                auto task = TryTake(index);
+                if (!task) {
+                    std::unique_lock lock(mutex_);
+                    wakeup_.wait(lock, [this] { return stopping_ || pending_.load(std::memory_order_relaxed) > 0; });
+                    if (stopping_ && pending_.load(std::memory_order_relaxed) == 0)
+                        break;
+                    continue;
+                }
+
+                {
+                    LocalFrame frame(frame_capacity_, env);
+                    task();
+                }
+                if (env->ExceptionCheck())
+                    env->ExceptionClear();
+            }
+
+            current_ = nullptr;
+        }
+
+        static inline thread_local Executor* current_ = nullptr;
+        static inline thread_local std::size_t current_index_ = 0;
+
+        jint frame_capacity_;
+        std::vector<std::unique_ptr<WorkQueue>> queues_;
+        std::vector<std::thread> workers_;
+        std::atomic<std::size_t> next_queue_{0};
+        std::atomic<std::size_t> pending_{0};
+        std::mutex mutex_;
+        std::condition_variable wakeup_;
+        bool stopping_ = false;
+        std::atomic<bool> attach_failed_{false};
+    };
+
+    // ============================================================================
+    // Async Invocation: <method>Async() on a pool of attached threads
+    // ============================================================================
+
+    template<typename T>
+    class AsyncResult;
+
+    namespace detail {
+
+        template<typename Result, typename Call>
+        auto DispatchAsync(Executor& executor, Call call) -> AsyncResult<Result>;
+
+    } // namespace detail
+
+    // Handle to a call dispatched by a generated <method>Async() variant.
+    // Block with Get(), or co_await it from a coroutine (resumed on the worker thread).
+    template<typename T>
+    class AsyncResult {
+        struct Empty {};
+        using Value = std::conditional_t<std::is_void_v<T>, Empty, T>;
+
+        enum class Status {
+            Pending,
+            Running,
+            Cancelled,
+            Finished,
+        };
+
+        struct State {
+            std::mutex mutex;
+            std::condition_variable settled;
+            Status status = Status::Pending;
+            std::optional<Value> value;
+            std::exception_ptr error;
+            std::coroutine_handle<> continuation;
+        };
+
+    public:
+        // Cancels the call if no worker has picked it up yet; returns false once it is running or done
+        auto Cancel() -> bool {
+            std::coroutine_handle<> continuation;
+            {
+                std::lock_guard lock(state_->mutex);
+                if (state_->status != Status::Pending)
+                    return false;
+                state_->status = Status::Cancelled;
+                continuation = std::exchange(state_->continuation, nullptr);
+            }
+            state_->settled.notify_all();
+            if (continuation)
+                continuation.resume();
+            return true;
+        }
+
+        [[nodiscard]] auto Ready() const -> bool {
+            std::lock_guard lock(state_->mutex);
+            return state_->status == Status::Finished || state_->status == Status::Cancelled;
+        }
+
+        void Wait() const {
+            std::unique_lock lock(state_->mutex);
+            state_->settled.wait(lock, [this] { 
+                return state_->status == Status::Finished || state_->status == Status::Cancelled; 
+            });
+        }
+
+        // Rethrows the exception of the call; throws std::runtime_error if it was cancelled. Call once.
+        auto Get() -> T {
+            Wait();
+
+            std::lock_guard lock(state_->mutex);
+            if (state_->status == Status::Cancelled)
+                throw std::runtime_error("AsyncResult::Get(): call was cancelled");
+            if (state_->error)
+                std::rethrow_exception(state_->error);
+
+            if constexpr (!std::is_void_v<T>) {
+                return std::move(*state_->value);
+            }
+        }
+
+        [[nodiscard]] auto await_ready() const -> bool {
+            return Ready();
+        }
+
+        auto await_suspend(std::coroutine_handle<> continuation) -> bool {
+            std::lock_guard lock(state_->mutex);
+            if (state_->status == Status::Finished || state_->status == Status::Cancelled)
+                return false;
+            state_->continuation = continuation;
+            return true;
+        }
+
+        auto await_resume() -> T {
+            return Get();
+        }
+
+    private:
+        template<typename Result, typename Call>
+        friend auto detail::DispatchAsync(Executor& executor, Call call) -> AsyncResult<Result>;
+
+        AsyncResult() : state_(std::make_shared<State>()) {}
+
+        template<typename Call>
+        static void Run(std::shared_ptr<State> const& state, Call& call) {
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->status != Status::Pending)
+                    return;
+                state->status = Status::Running;
+            }
+
+            std::optional<Value> value;
+            std::exception_ptr error;
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    call();
+                    value.emplace();
+                } else {
+                    value.emplace(call());
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::coroutine_handle<> continuation;
+            {
+                std::lock_guard lock(state->mutex);
+                state->value = std::move(value);
+                state->error = error;
+                state->status = Status::Finished;
+                continuation = std::exchange(state->continuation, nullptr);
+            }
+            state->settled.notify_all();
+            if (continuation)
+                continuation.resume();
+        }
+
+        std::shared_ptr<State> state_;
+    };
+
+    // Pool behind the generated <method>Async() variants.
+    // Created on first use and never destroyed, so no worker is joined during static destruction.
+    [[nodiscard]] inline auto AsyncExecutor() -> Executor& {
+        static auto* executor = new Executor(
+            std::max(2u, std::thread::hardware_concurrency()),
+            AttachOptions{.daemon = true, .name = "jbridge-async"}
+        );
+        return *executor;
+    }
+
+    namespace detail {
+
+        namespace jni {
+
+            // Heap copy of a mirror whose refs are promoted to global refs; demoted when the last owner goes
+            template<concepts::DerivedFromJBase Tp>
+            [[nodiscard]] inline auto ShareGlobal(Tp value) -> std::shared_ptr<Tp> {
+                auto owned = std::make_unique<Tp>(std::move(value));
+                JniRef<Tp>::Promote(owned.get());
+                return {owned.release(), [](Tp* object) {
+                    JniRef<Tp>::Demote(object);
+                    delete object;
+                }};
+            }
+
+        } // namespace jni
+
+        // Carry: what an argument becomes for the trip to the worker (local refs are promoted to global refs)
+        template<typename T>
+        [[nodiscard]] inline auto Carry(T&& t) {
+            using ArgType = std::remove_cvref_t<T>;
+
+            if constexpr (concepts::JniPrimitive<ArgType>) {
+                return t;
+            } else if constexpr (concepts::DerivedFromJBase<ArgType>) {
+                return jni::ShareGlobal(ArgType(t));
+            } else if constexpr (concepts::JniObjectType<ArgType>) {
+                return MakeGlobalRef(t);
+            } else if constexpr (requires { requires std::same_as<ArgType, ObjectRef<typename ArgType::mirror_type>>; }) {
+                return MakeGlobalRef(t.get());
+            } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+                return std::string(std::string_view(t));
+            } else if constexpr (traits::is_array_wrapper_v<ArgType> || traits::is_direct_buffer_v<ArgType>) {
+                // Passes the Java object as is: uncommitted writes to a copied buffer are not carried
+                return MakeGlobalRef(t.Raw());
+            } else {
+                static_assert(traits::deferred_false<T>::value, "Cannot carry argument to an async call");
+            }
+        }
+
+        template<typename Carried>
+        [[nodiscard]] inline decltype(auto) Uncarry(Carried& carried) {
+            if constexpr (requires { typename Carried::element_type; }) {
+                if constexpr (std::is_base_of_v<_jobject, typename Carried::element_type>) {
+                    return carried.get();
+                } else {
+                    return *carried;
+                }
+            } else {
+                return (carried);
+            }
+        }
+
+        // Export: what a result becomes for the trip back (the worker's LocalFrame is popped after the call)
+        template<typename T>
+        [[nodiscard]] inline auto Export(T&& t) {
+            using ResultType = std::remove_cvref_t<T>;
+
+            if constexpr (concepts::DerivedFromJBase<ResultType>) {
+                return jni::ShareGlobal(std::move(t));
+            } else if constexpr (concepts::JniObjectType<ResultType>) {
+                return MakeGlobalRef(t);
+            } else if constexpr (requires { requires std::same_as<ResultType, ObjectRef<typename ResultType::mirror_type>>; }) {
+                return MakeGlobalRef(t.get());
+            } else if constexpr (traits::is_array_wrapper_v<ResultType>) {
+                if constexpr (std::same_as<decltype(t.Raw()), jobjectArray>) {
+                    return MakeGlobalRef(t.Raw());
+                } else {
+                    auto const& array = t;
+                    using Element = std::remove_cv_t<std::remove_pointer_t<decltype(array.begin())>>;
+                    return std::vector<Element>(array.begin(), array.end());
+                }
+            } else {
+                return std::forward<T>(t);
+            }
+        }
+
+        template<typename T>
+        struct async_result {
+            using type = decltype(Export(std::declval<T>()));
+        };
+
+        template<>
+        struct async_result<void> {
+            using type = void;
+        };
+
+        template<typename T>
+        using async_result_t = typename async_result<T>::type;
+
+        template<typename Result, typename Call>
+        inline auto DispatchAsync(Executor& executor, Call call) -> AsyncResult<Result> {
+            AsyncResult<Result> result;
+            executor.Post([state = result.state_, call = std::move(call)]() mutable {
+                AsyncResult<Result>::Run(state, call);
+            });
+            return result;
+        }
+
+        // Backs the generated <method>Async(): the receiver and arguments travel as global refs
+        template<typename Receiver, typename Fn, typename ...Args>
+        [[nodiscard]] inline auto InvokeAsync(Receiver& receiver, Fn fn, Args&&... args) {
+            using Result = async_result_t<decltype(fn(receiver, Uncarry(std::declval<decltype(Carry(std::forward<Args>(args)))&>())...))>;
+
+            auto call = [fn, self = jni::ShareGlobal(receiver), ...carried = Carry(std::forward<Args>(args))]() mutable {
+                if constexpr (std::is_void_v<Result>) {
+                    fn(*self, Uncarry(carried)...);
+                } else {
+                    return Export(fn(*self, Uncarry(carried)...));
+                }
+            };
+            return DispatchAsync<Result>(AsyncExecutor(), std::move(call));
+        }
+
+        template<typename Fn, typename ...Args>
+        [[nodiscard]] inline auto InvokeStaticAsync(Fn fn, Args&&... args) {
+            using Result = async_result_t<decltype(fn(Uncarry(std::declval<decltype(Carry(std::forward<Args>(args)))&>())...))>;
+
+            auto call = [fn, ...carried = Carry(std::forward<Args>(args))]() mutable {
+                if constexpr (std::is_void_v<Result>) {
+                    fn(Uncarry(carried)...);
+                } else {
+                    return Export(fn(Uncarry(carried)...));
+                }
+            };
+            return DispatchAsync<Result>(AsyncExecutor(), std::move(call));
+        }
+
+    } // namespace detail
+
+    // ============================================================================
+    // Struct Marshalling: Java objects <-> C++ aggregates (JBRIDGE_DEFINE_STRUCT)
+    // ============================================================================
+
+    namespace traits {
+
+        // Specialized by JBRIDGE_DEFINE_STRUCT: mirror_type and a tuple of detail::StructField
+        template<typename T>
+        struct struct_binding;
+
+    } // namespace traits
+
+    namespace concepts {
+
+        template<typename T>
+        concept BoundStruct = requires {
+            typename traits::struct_binding<T>::mirror_type;
+            traits::struct_binding<T>::fields;
+        };
+
+    } // namespace concepts
+
+    namespace detail {
+
+        // One C++ member mapped to the Java instance field of the same name
+        template<typename Struct, typename Member>
+        struct StructField {
+            using member_type = Member;
+
+            Member Struct::* member;
+            const char* name;
+        };
+
+        template<typename Struct, typename Member>
+        StructField(Member Struct::*, const char*) -> StructField<Struct, Member>;
+
+        template<typename Fields>
+        struct struct_columns;
+
+        template<typename Struct, typename ...Members>
+        struct struct_columns<std::tuple<StructField<Struct, Members>...>> {
+            using type = std::tuple<std::vector<Members>...>;
+        };
+
+        template<typename T>
+        using struct_fields_t = std::remove_cvref_t<decltype(traits::struct_binding<T>::fields)>;
+
+        template<auto Member, typename T>
+        [[nodiscard]] consteval auto StructColumnIndex() -> std::size_t {
+            constexpr auto& fields = traits::struct_binding<T>::fields;
+            constexpr auto count = std::tuple_size_v<struct_fields_t<T>>;
+
+            return [&]<std::size_t ...I>(std::index_sequence<I...>) {
+                std::size_t index = count;
+                ([&] {
+                    if constexpr (std::same_as<decltype(std::get<I>(fields).member), decltype(Member)>) {
+                        if (std::get<I>(fields).member == Member)
+                            index = I;
+                    }
+                }(), ...);
+                return index;
+            }(std::make_index_sequence<count>{});
+        }
+
+        // Registered by JBRIDGE_DEFINE_STRUCT so jb::Preload resolves the struct's field IDs
+        template<typename T>
+        inline void ResolveStructFields();
+
+    } // namespace detail
+
+    // Structure-of-arrays buffer for a bound struct: one contiguous column per member
+    template<concepts::BoundStruct T>
+    class StructArrays {
+    public:
+        StructArrays() = default;
+
+        explicit StructArrays(std::size_t size) {
+            Resize(size);
+        }
+
+        void Resize(std::size_t size) {
+            std::apply([size](auto&... column) { (column.resize(size), ...); }, columns_);
+            size_ = size;
+        }
+
+        [[nodiscard]] auto Size() const noexcept -> std::size_t {
+            return size_;
+        }
+
+        // Column of one member, e.g. Column<&Point::x>()
+        template<auto Member>
+            requires std::is_member_object_pointer_v<decltype(Member)>
+        [[nodiscard]] auto Column() noexcept {
+            return std::span{std::get<ColumnIndex<Member>()>(columns_)};
+        }
+
+        template<auto Member>
+            requires std::is_member_object_pointer_v<decltype(Member)>
+        [[nodiscard]] auto Column() const noexcept {
+            return std::span{std::get<ColumnIndex<Member>()>(columns_)};
+        }
+
+        // Column by declaration order in JBRIDGE_DEFINE_STRUCT
+        template<std::size_t I>
+        [[nodiscard]] auto Column() noexcept {
+            return std::span{std::get<I>(columns_)};
+        }
+
+        template<std::size_t I>
+        [[nodiscard]] auto Column() const noexcept {
+            return std::span{std::get<I>(columns_)};
+        }
+
+        // Row as an aggregate
+        [[nodiscard]] auto Get(std::size_t index) const -> T {
+            T row{};
+            ForEachField([&](auto const& field, auto const& column) {
+                row.*field.member = column[index];
+            });
+            return row;
+        }
+
+        void Set(std::size_t index, T const& row) {
+            ForEachField([&](auto const& field, auto& column) {
+                column[index] = row.*field.member;
+            });
+        }
+
+    private:
+        template<auto Member>
+        static consteval auto ColumnIndex() -> std::size_t {
+            constexpr auto index = detail::StructColumnIndex<Member, T>();
+            static_assert(index < std::tuple_size_v<detail::struct_fields_t<T>>, 
+                          "Member is not listed in JBRIDGE_DEFINE_STRUCT");
+            return index;
+        }
+
+        template<typename Fn>
+        void ForEachField(Fn&& fn) {
+            [&]<std::size_t ...I>(std::index_sequence<I...>) {
+                (fn(std::get<I>(traits::struct_binding<T>::fields), std::get<I>(columns_)), ...);
+            }(std::make_index_sequence<std::tuple_size_v<detail::struct_fields_t<T>>>{});
+        }
+
+        template<typename Fn>
+        void ForEachField(Fn&& fn) const {
+            [&]<std::size_t ...I>(std::index_sequence<I...>) {
+                (fn(std::get<I>(traits::struct_binding<T>::fields), std::get<I>(columns_)), ...);
+            }(std::make_index_sequence<std::tuple_size_v<detail::struct_fields_t<T>>>{});
+        }
+
+        template<concepts::BoundStruct>
+        friend struct Struct;
+
+        typename detail::struct_columns<detail::struct_fields_t<T>>::type columns_;
+        std::size_t size_ = 0;
+    };
+
+    // Field IDs are resolved once per struct; every accessor takes the JNIEnv from the caller.
+    // Members must be JNI primitive types (jint, jdouble, jboolean, ...).
+    template<concepts::BoundStruct T>
+    struct Struct {
+        using mirror_type = typename traits::struct_binding<T>::mirror_type;
+
+        [[nodiscard]] static auto Load(jobject object, JNIEnv* env = detail::jni::GetEnv()) -> T {
+            auto const& ids = FieldIds(env);
+            T value{};
+            ForEachField([&](std::size_t i, auto const& field) {
+                using Member = typename std::remove_cvref_t<decltype(field)>::member_type;
+                value.*field.member = traits::jni_field<Member, detail::NonStatic>::access(env, ids[i], object);
+            });
+            return value;
+        }
+
+        static void Store(jobject object, T const& value, JNIEnv* env = detail::jni::GetEnv()) {
+            auto const& ids = FieldIds(env);
+            ForEachField([&](std::size_t i, auto const& field) {
+                using Member = typename std::remove_cvref_t<decltype(field)>::member_type;
+                traits::jni_field<Member, detail::NonStatic>::set(env, ids[i], object, value.*field.member);
+            });
+        }
+
+        // Reads every element into out (resized to the array length). Elements are fetched in
+        // chunks and each field is read in its own loop over the chunk. Null elements yield T{}.
+        template<typename ThreadingPolicy>
+        static void Gather(ObjectArray<mirror_type, ThreadingPolicy>& array, StructArrays<T>& out,
+                           JNIEnv* env = detail::jni::GetEnv()) {
+            auto const& ids = FieldIds(env);
+            out.Resize(array.Size());
+
+            ForEachChunk(array, env, [&](std::size_t base, std::span<jobject const> chunk) {
+                ForEachColumn(out.columns_, [&](std::size_t f, auto const& field, auto& column) {
+                    using Member = typename std::remove_cvref_t<decltype(field)>::member_type;
+                    auto id = ids[f];
+                    for (std::size_t i = 0; i < chunk.size(); ++i) {
+                        column[base + i] = chunk[i] 
+                            ? traits::jni_field<Member, detail::NonStatic>::access(env, id, chunk[i]) 
+                            : Member{};
+                    }
+                });
+            });
+        }
+
+        template<typename ThreadingPolicy>
+        [[nodiscard]] static auto Gather(ObjectArray<mirror_type, ThreadingPolicy>& array,
+                                         JNIEnv* env = detail::jni::GetEnv()) -> StructArrays<T> {
+            StructArrays<T> out;
+            Gather(array, out, env);
+            return out;
+        }
+
+        // Writes every row back to the matching element; null elements are skipped
+        template<typename ThreadingPolicy>
+        static void Scatter(StructArrays<T> const& in, ObjectArray<mirror_type, ThreadingPolicy>& array,
+                            JNIEnv* env = detail::jni::GetEnv()) {
+            if (in.Size() != array.Size())
+                throw std::length_error("Struct::Scatter(): buffer and array sizes differ");
+
+            auto const& ids = FieldIds(env);
+
+            ForEachChunk(array, env, [&](std::size_t base, std::span<jobject const> chunk) {
+                ForEachColumn(in.columns_, [&](std::size_t f, auto const& field, auto const& column) {
+                    using Member = typename std::remove_cvref_t<decltype(field)>::member_type;
+                    auto id = ids[f];
+                    for (std::size_t i = 0; i < chunk.size(); ++i) {
+                        if (chunk[i]) {
+                            traits::jni_field<Member, detail::NonStatic>::set(env, id, chunk[i], column[base + i]);
+                        }
+                    }
+                });
+            });
+        }
+
+    private:
+        friend void detail::ResolveStructFields<T>();
+
+        static constexpr auto& kFields = traits::struct_binding<T>::fields;
+        static constexpr std::size_t kFieldCount = std::tuple_size_v<detail::struct_fields_t<T>>;
+
+        // Element refs held at once while gathering/scattering
+        static constexpr std::size_t kChunkSize = 64;
+
+        [[nodiscard]] static auto FieldIds(JNIEnv* env) -> std::array<jfieldID, kFieldCount> const& {
+            static auto const ids = [env] {
+                auto cls = detail::jni::FindClassFor<mirror_type>();
+                std::array<jfieldID, kFieldCount> resolved{};
+                ForEachField([&](std::size_t i, auto const& field) {
+                    using Member = typename std::remove_cvref_t<decltype(field)>::member_type;
+                    static_assert(concepts::JniPrimitive<Member> && !std::same_as<Member, bool> && 
+                                  !std::same_as<Member, char>,
+                                  "JBRIDGE_DEFINE_STRUCT members must be JNI primitive types");
+
+                    resolved[i] = detail::CheckMemberId(env->GetFieldID(cls, field.name, traits::fqcnify<Member>().data()), 
+                                                        field.name, env);
+                });
+                return resolved;
+            }();
+            return ids;
+        }
+
+        template<typename Fn>
+        static void ForEachField(Fn&& fn) {
+            [&]<std::size_t ...I>(std::index_sequence<I...>) {
+                (fn(I, std::get<I>(kFields)), ...);
+            }(std::make_index_sequence<kFieldCount>{});
+        }
+
+        template<typename Columns, typename Fn>
+        static void ForEachColumn(Columns& columns, Fn&& fn) {
+            [&]<std::size_t ...I>(std::index_sequence<I...>) {
+                (fn(I, std::get<I>(kFields), std::get<I>(columns)), ...);
+            }(std::make_index_sequence<kFieldCount>{});
+        }
+
+        template<typename ThreadingPolicy, typename Fn>
+        static void ForEachChunk(ObjectArray<mirror_type, ThreadingPolicy>& array, JNIEnv* env, Fn&& fn) {
+            if (env->EnsureLocalCapacity(static_cast<jint>(kChunkSize)) != JNI_OK)
+                throw std::runtime_error("Struct: EnsureLocalCapacity() failed");
+
+            auto raw = array.Raw();
+            auto size = array.Size();
+            std::array<jobject, kChunkSize> chunk{};
+
+            for (std::size_t base = 0; base < size; base += kChunkSize) {
+                auto count = std::min(kChunkSize, size - base);
+                for (std::size_t i = 0; i < count; ++i) {
+                    chunk[i] = env->GetObjectArrayElement(raw, static_cast<jsize>(base + i));
+                }
+
+                struct Release {
+                    JNIEnv* env;
+                    std::span<jobject> refs;
+                    ~Release() {
+                        for (auto ref : refs) {
+                            if (ref) env->DeleteLocalRef(ref);
+                        }
+                    }
+                } release{env, std::span{chunk.data(), count}};
+
+                fn(base, std::span<jobject const>{chunk.data(), count});
+            }
+        }
+    };
+
+    namespace detail {
+
+        template<typename T>
+        inline void ResolveStructFields() {
+            (void)Struct<T>::FieldIds(jni::GetEnv());
+        }
+
+    } // namespace detail
+
+    // ============================================================================
+    // Collections: Batched bridges for java.util.List / Map / Iterable
+    // ============================================================================
+
+    namespace detail::jni {
+
+        // Method IDs resolved once per interface
+
+        struct CollectionMethods {
+            jclass cls;
+            jmethodID size;
+            jmethodID to_array;
+            jmethodID add;
+
+            [[nodiscard]] static auto Get(JNIEnv* env) -> CollectionMethods const& {
+                static const CollectionMethods methods = [env] {
+                    auto cls = FindCachedClass<str::arrayify("java/util/Collection")>();
+                    return CollectionMethods{
+                        cls,
+                        env->GetMethodID(cls, "size", "()I"),
+                        env->GetMethodID(cls, "toArray", "()[Ljava/lang/Object;"),
+                        env->GetMethodID(cls, "add", "(Ljava/lang/Object;)Z"),
+                    };
+                }();
+                return methods;
+            }
+        };
+
+        struct IterableMethods {
+            jmethodID iterator;
+            jmethodID has_next;
+            jmethodID next;
+
+            [[nodiscard]] static auto Get(JNIEnv* env) -> IterableMethods const& {
+                static const IterableMethods methods = [env] {
+                    auto iterable = FindCachedClass<str::arrayify("java/lang/Iterable")>();
+                    auto iterator = FindCachedClass<str::arrayify("java/util/Iterator")>();
+                    return IterableMethods{
+                        env->GetMethodID(iterable, "iterator", "()Ljava/util/Iterator;"),
+                        env->GetMethodID(iterator, "hasNext", "()Z"),
+                        env->GetMethodID(iterator, "next", "()Ljava/lang/Object;"),
+                    };
+                }();
+                return methods;
+            }
+        };
+
+        struct ListMethods {
+            jmethodID get;
+            jclass array_list;
+            jmethodID array_list_from;      // ArrayList(Collection)
+            jclass arrays;
+            jmethodID as_list;              // Arrays.asList(Object...)
+
+            [[nodiscard]] static auto Get(JNIEnv* env) -> ListMethods const& {
+                static const ListMethods methods = [env] {
+                    auto list = FindCachedClass<str::arrayify("java/util/List")>();
+                    auto array_list = FindCachedClass<str::arrayify("java/util/ArrayList")>();
+                    auto arrays = FindCachedClass<str::arrayify("java/util/Arrays")>();
+                    return ListMethods{
+                        env->GetMethodID(list, "get", "(I)Ljava/lang/Object;"),
+                        array_list,
+                        env->GetMethodID(array_list, "<init>", "(Ljava/util/Collection;)V"),
+                        arrays,
+                        env->GetStaticMethodID(arrays, "asList", "([Ljava/lang/Object;)Ljava/util/List;"),
+                    };
+                }();
+                return methods;
+            }
+        };
+
+        struct MapMethods {
+            jmethodID size;
+            jmethodID get;
+            jmethodID put;
+            jmethodID key_set;
+            jmethodID values;
+            jclass hash_map;
+            jmethodID hash_map_new;         // HashMap(int)
+            jmethodID hash_map_copy;        // HashMap(Map)
+
+            [[nodiscard]] static auto Get(JNIEnv* env) -> MapMethods const& {
+                static const MapMethods methods = [env] {
+                    auto map = FindCachedClass<str::arrayify("java/util/Map")>();
+                    auto hash_map = FindCachedClass<str::arrayify("java/util/HashMap")>();
+                    return MapMethods{
+                        env->GetMethodID(map, "size", "()I"),
+                        env->GetMethodID(map, "get", "(Ljava/lang/Object;)Ljava/lang/Object;"),
+                        env->GetMethodID(map, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;"),
+                        env->GetMethodID(map, "keySet", "()Ljava/util/Set;"),
+                        env->GetMethodID(map, "values", "()Ljava/util/Collection;"),
+                        hash_map,
+                        env->GetMethodID(hash_map, "<init>", "(I)V"),
+                        env->GetMethodID(hash_map, "<init>", "(Ljava/util/Map;)V"),
+                    };
+                }();
+                return methods;
+            }
+        };
+
+        // Unboxes through the public <type>Value() method; the wrappers' `value` fields are
+        // private core-library API, which Android restricts as non-SDK interface access
+        template<concepts::JniPrimitive T>
+        [[nodiscard]] inline auto Unbox(JNIEnv* env, jobject boxed) -> T {
+            using V = box_value_t<T>;
+
+            if (!boxed)
+                return T{};
+
+            static const jmethodID value_method = [env] {
+                constexpr auto name = [] {
+                    if constexpr (std::same_as<V, jboolean>) return "booleanValue";
+                    else if constexpr (std::same_as<V, jbyte>) return "byteValue";
+                    else if constexpr (std::same_as<V, jchar>) return "charValue";
+                    else if constexpr (std::same_as<V, jshort>) return "shortValue";
+                    else if constexpr (std::same_as<V, jint>) return "intValue";
+                    else if constexpr (std::same_as<V, jlong>) return "longValue";
+                    else if constexpr (std::same_as<V, jfloat>) return "floatValue";
+                    else return "doubleValue";
+                }();
+                return env->GetMethodID(BoxClass<V>(), name, 
+                                        str::add_all(str::arrayify("()"), traits::signature<V>::SIGNATURE).data());
+            }();
+            return static_cast<T>(traits::jni_call<V, NonStatic>::call(env, value_method, boxed));
+        }
+
+        // Conversion between a collection element (jobject) and its C++ type
+        template<typename T>
+        struct collection_element;
+
+        // Mirrors keep the element's local ref
+        template<concepts::DerivedFromJBase T>
+        struct collection_element<T> {
+            static constexpr bool kKeepsRef = true;
+
+            [[nodiscard]] static auto Class() -> jclass {
+                return FindClassFor<T>();
+            }
+
+            [[nodiscard]] static auto From(JNIEnv*, jobject element) -> T {
+                return T{element};
+            }
+
+            [[nodiscard]] static auto To(JNIEnv* env, T const& value) -> jobject {
+                return env->NewLocalRef(value.GetObject());
+            }
+        };
+
+        template<>
+        struct collection_element<std::string> {
+            static constexpr bool kKeepsRef = false;
+
+            [[nodiscard]] static auto Class() -> jclass {
+                return FindCachedClass<str::arrayify("java/lang/String")>();
+            }
+
+            [[nodiscard]] static auto From(JNIEnv* env, jobject element) -> std::string {
+                return ToStdString(static_cast<jstring>(element), Utf8Mode::Modified, env);
+            }
+
+            [[nodiscard]] static auto To(JNIEnv* env, std::string const& value) -> jobject {
+                return env->NewStringUTF(value.c_str());
+            }
+        };
+
+        // Boxed primitives (List<Integer> -> jint, ...)
+        template<concepts::JniPrimitive T>
+        struct collection_element<T> {
+            static constexpr bool kKeepsRef = false;
+
+            [[nodiscard]] static auto Class() -> jclass {
+                return BoxClass<box_value_t<T>>();
+            }
+
+            [[nodiscard]] static auto From(JNIEnv* env, jobject element) -> T {
+                return Unbox<T>(env, element);
+            }
+
+            [[nodiscard]] static auto To(JNIEnv* env, T value) -> jobject {
+                return Box(env, value);
+            }
+        };
+
+        // One toArray() for Collections; other Iterables are drained through iterator() once
+        [[nodiscard]] inline auto SnapshotArray(JNIEnv* env, jobject iterable) -> jobjectArray {
+            if (!iterable)
+                return nullptr;
+
+            auto const& collection = CollectionMethods::Get(env);
+
+            if (env->IsInstanceOf(iterable, collection.cls)) {
+                auto array = static_cast<jobjectArray>(env->CallObjectMethod(iterable, collection.to_array));
+                CheckException(env);
+                return array;
+            }
+
+            auto const& methods = IterableMethods::Get(env);
+            auto iterator = env->CallObjectMethod(iterable, methods.iterator);
+            CheckException(env);
+
+            // Elements are parked as global refs so the local ref table does not grow with the size
+            struct Drained {
+                JNIEnv* env;
+                jobject iterator;
+                std::vector<jobject> elements;
+                ~Drained() {
+                    for (auto element : elements) {
+                        if (element) env->DeleteGlobalRef(element);
+                    }
+                    env->DeleteLocalRef(iterator);
+                }
+            } drained{env, iterator, {}};
+
+            while (true) {
+                auto has_next = env->CallBooleanMethod(iterator, methods.has_next);
+                CheckException(env);
+                if (!has_next)
+                    break;
+
+                auto element = env->CallObjectMethod(iterator, methods.next);
+                CheckException(env);
+                drained.elements.push_back(element ? env->NewGlobalRef(element) : nullptr);
+                env->DeleteLocalRef(element);
+            }
+
+            if (drained.elements.size() > static_cast<std::size_t>(std::numeric_limits<jsize>::max()))
+                throw std::length_error("Iterable: too many elements for a Java array");
+
+            auto array = env->NewObjectArray(static_cast<jsize>(drained.elements.size()), 
+                                             FindCachedClass<str::arrayify("java/lang/Object")>(), nullptr);
+            if (!array)
+                throw std::runtime_error("Iterable: NewObjectArray() failed");
+
+            for (std::size_t i = 0; i < drained.elements.size(); ++i) {
+                env->SetObjectArrayElement(array, static_cast<jsize>(i), drained.elements[i]);
+            }
+            return array;
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto NewElementArray(JNIEnv* env, std::size_t size) -> jobjectArray {
+            if (size > static_cast<std::size_t>(std::numeric_limits<jsize>::max()))
+                throw std::length_error("Collection: too many elements for a Java array");
+
+            auto array = env->NewObjectArray(static_cast<jsize>(size), collection_element<T>::Class(), nullptr);
+            if (!array)
+                throw std::runtime_error("Collection: NewObjectArray() failed");
+            return array;
+        }
+
+        // Fills a new element array from a C++ range, releasing each converted element as it goes
+        template<typename T, std::ranges::sized_range R>
+        [[nodiscard]] inline auto ToElementArray(JNIEnv* env, R&& values) -> jobjectArray {
+            if constexpr (concepts::JniPrimitive<T>) {
+                return jb::BoxAll(std::forward<R>(values), env);
+            } else {
+                auto array = NewElementArray<T>(env, std::ranges::size(values));
+                jsize index = 0;
+                for (auto&& value : values) {
+                    auto element = collection_element<T>::To(env, value);
+                    env->SetObjectArrayElement(array, index++, element);
+                    env->DeleteLocalRef(element);
+                }
+                return array;
+            }
+        }
+
+    } // namespace detail::jni
+
+    namespace detail {
+
+        // Input iterator over a toArray() snapshot. Value elements (strings, unboxed primitives) are
+        // converted and their ref released on access; mirror elements stay valid until the iterator advances.
+        template<typename T>
+        class CollectionIterator {
+            using element = jni::collection_element<T>;
+
+            struct Snapshot {
+                JNIEnv* env;
+                jobjectArray array;
+                std::size_t size;
+
+                Snapshot(JNIEnv* env, jobjectArray array) 
+                    : env(env)
+                    , array(array)
+                    , size(array ? static_cast<std::size_t>(env->GetArrayLength(array)) : 0) {}
+
+                Snapshot(Snapshot const&) = delete;
+                Snapshot& operator=(Snapshot const&) = delete;
+
+                ~Snapshot() {
+                    if (array) env->DeleteLocalRef(array);
+                }
+            };
+
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            CollectionIterator() = default;
+
+            CollectionIterator(JNIEnv* env, jobjectArray array)
+                : snapshot_(std::make_shared<Snapshot>(env, array)) {}
+
+            CollectionIterator(CollectionIterator const& o) noexcept 
+                : snapshot_(o.snapshot_), index_(o.index_) {}
+
+            CollectionIterator& operator=(CollectionIterator const& o) noexcept {
+                if (this != &o) {
+                    Release();
+                    snapshot_ = o.snapshot_;
+                    index_ = o.index_;
+                }
+                return *this;
+            }
+
+            ~CollectionIterator() {
+                Release();
+            }
+
+            [[nodiscard]] auto operator*() const -> T {
+                auto env = snapshot_->env;
+                auto ref = env->GetObjectArrayElement(snapshot_->array, static_cast<jsize>(index_));
+
+                if constexpr (element::kKeepsRef) {
+                    Release();
+                    current_ = ref;
+                    return element::From(env, ref);
+                } else {
+                    auto value = element::From(env, ref);
+                    if (ref) env->DeleteLocalRef(ref);
+                    return value;
+                }
+            }
+
+            auto operator++() -> CollectionIterator& {
+                Release();
+                ++index_;
+                return *this;
+            }
+
+            void operator++(int) {
+                ++*this;
+            }
+
+            [[nodiscard]] friend bool operator==(CollectionIterator const& it, std::default_sentinel_t) noexcept {
+                return !it.snapshot_ || it.index_ >= it.snapshot_->size;
+            }
+
+        private:
+            void Release() const {
+                if (current_) {
+                    snapshot_->env->DeleteLocalRef(std::exchange(current_, nullptr));
+                }
+            }
+
+            std::shared_ptr<Snapshot> snapshot_;
+            std::size_t index_ = 0;
+            mutable jobject current_ = nullptr;
+        };
+
+        // Converts every element of a snapshot array; mirror results keep one local ref each
+        template<typename T>
+        [[nodiscard]] auto ConvertSnapshot(JNIEnv* env, jobjectArray array) -> std::vector<T> {
+            using element = jni::collection_element<T>;
+
+            jni::TemporaryRef<jobjectArray> owned(env, array);
+            auto size = array ? static_cast<std::size_t>(env->GetArrayLength(array)) : 0;
+
+            if constexpr (element::kKeepsRef) {
+                if (size && env->EnsureLocalCapacity(static_cast<jint>(size)) != JNI_OK)
+                    throw std::runtime_error("Collection: EnsureLocalCapacity() failed");
+            }
+
+            std::vector<T> values;
+            values.reserve(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                auto ref = env->GetObjectArrayElement(array, static_cast<jsize>(i));
+                values.push_back(element::From(env, ref));
+                if constexpr (!element::kKeepsRef) {
+                    if (ref) env->DeleteLocalRef(ref);
+                }
+            }
+            return values;
+        }
+
+    } // namespace detail
+
+    // Any java.lang.Iterable. Iteration and ToVector() take one toArray() snapshot;
+    // Iterables that are not Collections are drained through iterator() once.
+    // T: a mirror class, std::string, or a primitive for boxed elements (Integer -> jint, ...)
+    template<typename T>
+    class Iterable {
+    public:
+        using value_type = T;
+        using iterator = detail::CollectionIterator<T>;
+
+        constexpr Iterable() noexcept = default;
+
+        explicit Iterable(jobject object) noexcept : object_(object) {}
+
+        [[nodiscard]] auto begin(JNIEnv* env = detail::jni::GetEnv()) const -> iterator {
+            return iterator{env, detail::jni::SnapshotArray(env, object_.Get())};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> std::default_sentinel_t {
+            return {};
+        }
+
+        // Mirror elements each keep a local ref; collect them inside a LocalFrame sized accordingly
+        [[nodiscard]] auto ToVector(JNIEnv* env = detail::jni::GetEnv()) const -> std::vector<T> {
+            return detail::ConvertSnapshot<T>(env, detail::jni::SnapshotArray(env, object_.Get()));
+        }
+
+        [[nodiscard]] auto Raw() const noexcept -> jobject {
+            return object_.Get();
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return static_cast<bool>(object_);
+        }
+
+    protected:
+        detail::jni::JniObject<jobject> object_;
+    };
+
+    // java.util.List
+    template<typename T>
+    class List : public Iterable<T> {
+        using element = detail::jni::collection_element<T>;
+
+    public:
+        using Iterable<T>::Iterable;
+
+        // new ArrayList<>(Arrays.asList(array)): two calls into Java for the whole range
+        template<std::ranges::sized_range R>
+        [[nodiscard]] static auto From(R&& values, JNIEnv* env = detail::jni::GetEnv()) -> List {
+            auto const& methods = detail::jni::ListMethods::Get(env);
+            detail::jni::TemporaryRef<jobjectArray> array(env, 
+                detail::jni::ToElementArray<T>(env, std::forward<R>(values)));
+
+            detail::jni::TemporaryRef<jobject> fixed(env, 
+                env->CallStaticObjectMethod(methods.arrays, methods.as_list, array.Get()));
+            detail::jni::CheckException(env);
+
+            auto list = env->NewObject(methods.array_list, methods.array_list_from, fixed.Get());
+            detail::jni::CheckException(env);
+            return List{list};
+        }
+
+        [[nodiscard]] auto Size(JNIEnv* env = detail::jni::GetEnv()) const -> std::size_t {
+            auto size = env->CallIntMethod(this->Raw(), detail::jni::CollectionMethods::Get(env).size);
+            detail::jni::CheckException(env);
+            return static_cast<std::size_t>(size);
+        }
+
+        // One call per element: prefer iteration or ToVector() for bulk reads
+        [[nodiscard]] auto Get(std::size_t index, JNIEnv* env = detail::jni::GetEnv()) const -> T {
+            auto ref = env->CallObjectMethod(this->Raw(), detail::jni::ListMethods::Get(env).get, 
+                                             static_cast<jint>(index));
+            detail::jni::CheckException(env);
+
+            if constexpr (element::kKeepsRef) {
+                return element::From(env, ref);
+            } else {
+                detail::jni::TemporaryRef<jobject> owned(env, ref);
+                return element::From(env, ref);
+            }
+        }
+
+        void Add(T const& value, JNIEnv* env = detail::jni::GetEnv()) {
+            detail::jni::TemporaryRef<jobject> ref(env, element::To(env, value));
+            (void)env->CallBooleanMethod(this->Raw(), detail::jni::CollectionMethods::Get(env).add, ref.Get());
+            detail::jni::CheckException(env);
+        }
+    };
+
+    // java.util.Map. ToUnorderedMap() copies the map into a private HashMap first, so keys and
+    // values stay paired even when another thread modifies a concurrent map.
+    template<typename K, typename V>
+    class Map {
+        using key_element = detail::jni::collection_element<K>;
+        using value_element = detail::jni::collection_element<V>;
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+
+        constexpr Map() noexcept = default;
+
+        explicit Map(jobject object) noexcept : object_(object) {}
+
+        // new HashMap<>(capacity) followed by one put() per entry
+        template<std::ranges::sized_range R>
+        [[nodiscard]] static auto From(R&& entries, JNIEnv* env = detail::jni::GetEnv()) -> Map {
+            auto const& methods = detail::jni::MapMethods::Get(env);
+            auto capacity = std::min<std::size_t>(std::ranges::size(entries) * 4 / 3 + 1, 
+                                                  std::numeric_limits<jint>::max());
+
+            Map map{env->NewObject(methods.hash_map, methods.hash_map_new, static_cast<jint>(capacity))};
+            detail::jni::CheckException(env);
+
+            for (auto&& [key, value] : entries) {
+                map.Put(key, value, env);
+            }
+            return map;
+        }
+
+        [[nodiscard]] auto Size(JNIEnv* env = detail::jni::GetEnv()) const -> std::size_t {
+            auto size = env->CallIntMethod(Raw(), detail::jni::MapMethods::Get(env).size);
+            detail::jni::CheckException(env);
+            return static_cast<std::size_t>(size);
+        }
+
+        // std::nullopt when the key is absent (or mapped to null)
+        [[nodiscard]] auto Get(K const& key, JNIEnv* env = detail::jni::GetEnv()) const -> std::optional<V> {
+            detail::jni::TemporaryRef<jobject> boxed_key(env, key_element::To(env, key));
+            auto ref = env->CallObjectMethod(Raw(), detail::jni::MapMethods::Get(env).get, boxed_key.Get());
+            detail::jni::CheckException(env);
+
+            if (!ref)
+                return std::nullopt;
+
+            if constexpr (value_element::kKeepsRef) {
+                return value_element::From(env, ref);
+            } else {
+                detail::jni::TemporaryRef<jobject> owned(env, ref);
+                return value_element::From(env, ref);
+            }
+        }
+
+        void Put(K const& key, V const& value, JNIEnv* env = detail::jni::GetEnv()) {
+            detail::jni::TemporaryRef<jobject> boxed_key(env, key_element::To(env, key));
+            detail::jni::TemporaryRef<jobject> boxed_value(env, value_element::To(env, value));
+            detail::jni::TemporaryRef<jobject> previous(env, 
+                env->CallObjectMethod(Raw(), detail::jni::MapMethods::Get(env).put, boxed_key.Get(), boxed_value.Get()));
+            detail::jni::CheckException(env);
+        }
+
+        // keySet() view (a new local ref)
+        [[nodiscard]] auto Keys(JNIEnv* env = detail::jni::GetEnv()) const -> Iterable<K> {
+            auto keys = env->CallObjectMethod(Raw(), detail::jni::MapMethods::Get(env).key_set);
+            detail::jni::CheckException(env);
+            return Iterable<K>{keys};
+        }
+
+        // values() view (a new local ref)
+        [[nodiscard]] auto Values(JNIEnv* env = detail::jni::GetEnv()) const -> Iterable<V> {
+            auto values = env->CallObjectMethod(Raw(), detail::jni::MapMethods::Get(env).values);
+            detail::jni::CheckException(env);
+            return Iterable<V>{values};
+        }
+
+        // new HashMap<>(map), then keySet().toArray() and values().toArray() on that copy: five calls
+        // into Java whatever the size. Nothing else can see the copy, so both arrays share one order.
+        template<typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+        [[nodiscard]] auto ToUnorderedMap(JNIEnv* env = detail::jni::GetEnv()) const 
+            -> std::unordered_map<K, V, Hash, KeyEqual> 
+        {
+            auto const& methods = detail::jni::MapMethods::Get(env);
+
+            detail::jni::TemporaryRef<jobject> copy(env, env->NewObject(methods.hash_map, methods.hash_map_copy, Raw()));
+            detail::jni::CheckException(env);
+
+            auto snapshot = [&](jmethodID view_method) {
+                detail::jni::TemporaryRef<jobject> view(env, env->CallObjectMethod(copy.Get(), view_method));
+                detail::jni::CheckException(env);
+                return detail::jni::SnapshotArray(env, view.Get());
+            };
+            detail::jni::TemporaryRef<jobjectArray> keys(env, snapshot(methods.key_set));
+            detail::jni::TemporaryRef<jobjectArray> values(env, snapshot(methods.values));
+
+            auto size = keys.Get() ? static_cast<std::size_t>(env->GetArrayLength(keys.Get())) : 0;
+
+            // Mirror keys and values keep their local refs
+            constexpr std::size_t kKeptPerEntry = (key_element::kKeepsRef ? 1 : 0) + (value_element::kKeepsRef ? 1 : 0);
+            if constexpr (kKeptPerEntry > 0) {
+                if (size > static_cast<std::size_t>(std::numeric_limits<jint>::max()) / kKeptPerEntry ||
+                    (size && env->EnsureLocalCapacity(static_cast<jint>(size * kKeptPerEntry)) != JNI_OK))
+                    throw std::runtime_error("Map::ToUnorderedMap(): EnsureLocalCapacity() failed");
+            }
+
+            auto take = [env]<typename Element>(Element, jobject ref) {
+                auto value = Element::From(env, ref);
+                if constexpr (!Element::kKeepsRef) {
+                    if (ref) env->DeleteLocalRef(ref);
+                }
+                return value;
+            };
+
+            std::unordered_map<K, V, Hash, KeyEqual> result;
+            result.reserve(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                auto key = env->GetObjectArrayElement(keys.Get(), static_cast<jsize>(i));
+                auto value = env->GetObjectArrayElement(values.Get(), static_cast<jsize>(i));
+                result.emplace(take(key_element{}, key), take(value_element{}, value));
+            }
+            return result;
+        }
+
+        [[nodiscard]] auto Raw() const noexcept -> jobject {
+            return object_.Get();
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return static_cast<bool>(object_);
+        }
+
+    private:
+        detail::jni::JniObject<jobject> object_;
+    };
+
+    // ============================================================================
+    // Preload: Eager resolution of class, method and field IDs
+    // ============================================================================
+
+    namespace detail::jni {
+
+        struct PreloadEntry {
+            const char* class_signature;
+            const char* member;
+            void (*resolve)();
+        };
+
+        // Filled during static initialization by the method/field macros
+        [[nodiscard]] inline auto PreloadEntries() -> std::vector<PreloadEntry>& {
+            static std::vector<PreloadEntry> entries;
+            return entries;
+        }
+
+        inline auto RegisterPreload(const char* class_signature, const char* member, void (*resolve)()) -> bool {
+            PreloadEntries().push_back({class_signature, member, resolve});
+            return true;
+        }
+
+    } // namespace detail::jni
+
+    // member is empty when the class itself could not be found
+    struct PreloadFailure {
+        std::string_view class_signature;
+        std::string_view member;
+    };
+
+    // Resolves the class and every method/field ID declared in each mirror, so first calls skip lazy lookup.
+    // Lookup errors are caught and returned; an empty result means everything resolved.
+    // With JBRIDGE_ABORT_ON_JAVA_EXCEPTION a missing member aborts like any other Java exception.
+    template<concepts::MirrorClass ...Mirrors>
+    [[nodiscard]] inline auto Preload(JNIEnv* env = detail::jni::GetEnv()) -> std::vector<PreloadFailure> {
+        using namespace detail::jni;
+
+        std::vector<PreloadFailure> failures;
+        auto preload = [&]<typename Mirror>() {
+            std::string_view signature{traits::class_signature_v<Mirror>.data()};
+
+            if (!FindClassFor<Mirror>()) {
+                env->ExceptionClear();
+                failures.push_back({signature, {}});
+                return;
+            }
+
+            for (auto const& entry : PreloadEntries()) {
+                if (signature != entry.class_signature)
+                    continue;
+
+                // Failed lookups throw and leave nothing cached, so a later call retries them
+                try {
+                    entry.resolve();
+                } catch (std::exception const&) {
+                    env->ExceptionClear();
+                    failures.push_back({signature, entry.member});
+                }
+            }
+        };
+
+        (preload.template operator()<Mirrors>(), ...);
+        return failures;
+    }
+
+    // Returns JNI_ERR if a native binding could not be registered (the Java exception is left pending)
+    inline auto Init(JavaVM* vm) noexcept -> jint {
+        detail::jni::vm_ = vm;
+
+        if (detail::jni::NativeBindings().empty())
+            return JNI_OK;
+
+        try {
+            RegisterNatives();
+        } catch (...) {
+            return JNI_ERR;
+        }
+        return JNI_OK;
+    }
+
+} // namespace jb
+
+// ============================================================================
+// Macros - Forward Declaration Support (Cyclic Reference Resolution)
+// ============================================================================
+
+// Generate class signature from package::class_name
+#define JBRIDGE_INTERNAL_MAKE_SIGNATURE(package, class_name) \
+    [] { \
+        using namespace jb::detail; \
+        auto symbol = arrayify(#package "::" #class_name); \
+        constexpr auto symbol_size = arraysize_of(symbol); \
+        std::array<char, symbol_size - namespace_depth(arrayify(#package "::" #class_name))> signature{}; \
+        replace_scope_to_slash(signature, symbol); \
+        return signature; \
+    }()
+
+// Forward declare a mirror class (enables cyclic references)
+// Usage: JBRIDGE_DECLARE_CLASS(java::lang::reflect, Method)
+#define JBRIDGE_DECLARE_CLASS(package, class_name) \
+    namespace package { struct class_name; } \
+    template<> \
+    struct jb::traits::class_signature_override<package::class_name> { \
+        static constexpr auto value = JBRIDGE_INTERNAL_MAKE_SIGNATURE(package, class_name); \
+    };
+
+// ============================================================================
+// Macros - Class Definition (Interface preserved for compatibility)
+// ============================================================================
+
+#define JBRIDGE_DEFINE_CLASS(package, class_name, class_scope)                                                      \
+namespace package {                                                                                                 \
+                                                                                                                    \
+    template<typename D>                                                                                            \
+    struct _M_base_ ## class_name {                                                                                 \
+                                                                                                                    \
+        static constexpr auto CLASS_SIGNATURE = JBRIDGE_INTERNAL_MAKE_SIGNATURE(package, class_name);               \
+                                                                                                                    \
+        template<typename ...Args>                                                                                  \
+        [[nodiscard]] static auto new_(Args&&... args) -> D {                                                       \
+            auto cls = jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>();                                         \
+            static auto constructor = jb::detail::CreateConstructor<Args...>(cls);                                  \
+            return D{constructor.call(cls, std::forward<Args>(args)...)};                                           \
+        }                                                                                                           \
+    };                                                                                                              \
+                                                                                                                    \
+    struct class_name : public jb::detail::BaseClass<class_name>, public _M_base_ ## class_name<class_name> class_scope; \
+}
+
+// Lists the JniObject / JNI ref members MakeGlobalRef promotes, replacing the word-by-word tag scan.
+// Members may also be types with their own JBRIDGE_GLOBAL_FIELDS or mirror objects.
+#define JBRIDGE_GLOBAL_FIELDS(...) \
+    friend struct jb::detail::jni::GlobalFieldAccess; \
+    [[nodiscard]] auto jbridge_global_fields_() noexcept { \
+        return std::tie(__VA_ARGS__); \
+    }
+
+#define JBRIDGE_REQUIRE_EXTENDED_CONSTRUCTION(class_name) using jb::detail::BaseClass<class_name>::BaseClass;
+
+// ============================================================================
+// Macros - Method Definition (supports cyclic references via method_return_t)
+// ============================================================================
+
+// Registers a member's ID resolver for jb::Preload (runs during static initialization)
+#define JBRIDGE_INTERNAL_PRELOAD(id, name, resolver)                                                                \
+static inline const bool id ## _preload_ =                                                                          \
+    jb::detail::jni::RegisterPreload(CLASS_SIGNATURE.data(), #name, [] { (void)resolver(); });
+
+// <method>Async(): runs the call on jb::AsyncExecutor() and returns a jb::AsyncResult
+#define JBRIDGE_INTERNAL_ASYNC(fn)                                                                                  \
+template<typename ...Args>                                                                                          \
+auto fn ## Async(Args&&... args) {                                                                                  \
+    return jb::detail::InvokeAsync(*this, [](auto& self, auto&&... carried) {                                       \
+        return self.fn(std::forward<decltype(carried)>(carried)...);                                                \
+    }, std::forward<Args>(args)...);                                                                                \
+}
+
+#define JBRIDGE_INTERNAL_STATIC_ASYNC(fn)                                                                           \
+template<typename ...Args>                                                                                          \
+static auto fn ## Async(Args&&... args) {                                                                           \
+    return jb::detail::InvokeStaticAsync([](auto&&... carried) {                                                    \
+        return fn(std::forward<decltype(carried)>(carried)...);                                                     \
+    }, std::forward<Args>(args)...);                                                                                \
+}
+
+#define JBRIDGE_DEFINE_METHOD(return_type, name, ...)                                                               \
+static auto name ## _method_() -> jb::detail::Method<return_type>& {                                                \
+    static auto name ## _ = jb::detail::CreateMethod<false, return_type __VA_OPT__(,) __VA_ARGS__>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return name ## _;                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(name, name, name ## _method_)                                                              \
+template<typename ...Args>                                                                                          \
+auto name(Args&&... args) {                                                                                         \
+    auto& name ## _ = name ## _method_();                                                                           \
+    if constexpr (std::is_void_v<return_type>) {                                                                    \
+        name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...);                                 \
+    } else {                                                                                                        \
+        return jb::traits::method_return_t<return_type>(name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...)); \
+    }                                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_ASYNC(name)
+
+#define JBRIDGE_DEFINE_ALIAS_METHOD(return_type, alias_name, name, ...)                                             \
+static auto alias_name ## _method_() -> jb::detail::Method<return_type>& {                                          \
+    static auto name ## _ = jb::detail::CreateMethod<false, return_type __VA_OPT__(,) __VA_ARGS__>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return name ## _;                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(alias_name, name, alias_name ## _method_)                                                  \
+template<typename ...Args>                                                                                          \
+auto alias_name(Args&&... args) {                                                                                   \
+    auto& name ## _ = alias_name ## _method_();                                                                     \
+    if constexpr (std::is_void_v<return_type>) {                                                                    \
+        name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...);                                 \
+    } else {                                                                                                        \
+        return jb::traits::method_return_t<return_type>(name ## _.template call<false>(object_.Get(), std::forward<Args>(args)...)); \
+    }                                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_ASYNC(alias_name)
+
+#define JBRIDGE_DEFINE_STATIC_METHOD(return_type, name, ...)                                                        \
+static auto name ## _method_() -> jb::detail::Method<return_type>& {                                                \
+    static auto name ## _ = jb::detail::CreateMethod<true, return_type __VA_OPT__(,) __VA_ARGS__>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return name ## _;                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(name, name, name ## _method_)                                                              \
+template<typename ...Args>                                                                                          \
+static auto name(Args&&... args) {                                                                                  \
+    auto& name ## _ = name ## _method_();                                                                           \
+    if constexpr (std::is_void_v<return_type>) {                                                                    \
+        name ## _.template call<true>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), std::forward<Args>(args)...); \
+    } else {                                                                                                        \
+        return jb::traits::method_return_t<return_type>(name ## _.template call<true>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), std::forward<Args>(args)...)); \
+    }                                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_STATIC_ASYNC(name)
+
+#define JBRIDGE_DEFINE_STATIC_ALIAS_METHOD(return_type, alias_name, name, ...)                                      \
+static auto alias_name ## _method_() -> jb::detail::Method<return_type>& {                                          \
+    static auto name ## _ = jb::detail::CreateMethod<true, return_type __VA_OPT__(,) __VA_ARGS__>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return name ## _;                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(alias_name, name, alias_name ## _method_)                                                  \
+template<typename ...Args>                                                                                          \
+static auto alias_name(Args&&... args) {                                                                            \
+    auto& name ## _ = alias_name ## _method_();                                                                     \
+    if constexpr (std::is_void_v<return_type>) {                                                                    \
+        name ## _.template call<true>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), std::forward<Args>(args)...); \
+    } else {                                                                                                        \
+        return jb::traits::method_return_t<return_type>(name ## _.template call<true>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), std::forward<Args>(args)...)); \
+    }                                                                                                               \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_STATIC_ASYNC(alias_name)
+
+// ============================================================================
+// Macros - Native Binding (registered by jb::Init via RegisterNatives)
+// ============================================================================
+
+#define JBRIDGE_INTERNAL_CONCAT_IMPL(a, b) a ## b
+#define JBRIDGE_INTERNAL_CONCAT(a, b) JBRIDGE_INTERNAL_CONCAT_IMPL(a, b)
+
+// Usage: JBRIDGE_DEFINE_NATIVE(your::package::Widget, onDraw, OnDraw)
+//        where OnDraw(Widget self, jint width) backs `native void onDraw(int width)`
+#define JBRIDGE_DEFINE_NATIVE(class_name, name, fn)                                                                 \
+[[maybe_unused]] static const bool JBRIDGE_INTERNAL_CONCAT(jbridge_native_, __COUNTER__) =                          \
+    jb::detail::jni::BindNative<jb::detail::NonStatic, class_name, &fn>(#name);
+
+// Usage: JBRIDGE_DEFINE_STATIC_NATIVE(your::package::MainActivity, testSetText, TestSetText)
+//        where TestSetText(TextView view) backs `static native void testSetText(TextView view)`
+#define JBRIDGE_DEFINE_STATIC_NATIVE(class_name, name, fn)                                                          \
+[[maybe_unused]] static const bool JBRIDGE_INTERNAL_CONCAT(jbridge_native_, __COUNTER__) =                          \
+    jb::detail::jni::BindNative<jb::detail::Static, class_name, &fn>(#name);
+
+// ============================================================================
+// Macros - Struct Marshalling
+// ============================================================================
+
+#define JBRIDGE_INTERNAL_FE_1(m, s, x) m(s, x)
+#define JBRIDGE_INTERNAL_FE_2(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_1(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_3(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_2(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_4(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_3(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_5(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_4(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_6(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_5(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_7(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_6(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_8(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_7(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_9(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_8(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_10(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_9(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_11(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_10(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_12(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_11(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_13(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_12(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_14(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_13(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_15(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_14(m, s, __VA_ARGS__)
+#define JBRIDGE_INTERNAL_FE_16(m, s, x, ...) m(s, x), JBRIDGE_INTERNAL_FE_15(m, s, __VA_ARGS__)
+
+#define JBRIDGE_INTERNAL_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
+#define JBRIDGE_INTERNAL_COUNT(...) JBRIDGE_INTERNAL_COUNT_IMPL(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1)
+#define JBRIDGE_INTERNAL_FOR_EACH(m, s, ...) \
+    JBRIDGE_INTERNAL_CONCAT(JBRIDGE_INTERNAL_FE_, JBRIDGE_INTERNAL_COUNT(__VA_ARGS__))(m, s, __VA_ARGS__)
+
+#define JBRIDGE_INTERNAL_STRUCT_FIELD(struct_name, member) jb::detail::StructField{&struct_name::member, #member}
+
+// Usage: JBRIDGE_DEFINE_STRUCT(your::package::Particle, Particle, x, y, mass)
+//        maps each member of the C++ aggregate to the Java instance field of the same name (up to 16)
+#define JBRIDGE_DEFINE_STRUCT(mirror, struct_name, ...)                                                             \
+template<>                                                                                                          \
+struct jb::traits::struct_binding<struct_name> {                                                                    \
+    using mirror_type = mirror;                                                                                     \
+    static constexpr auto fields = std::make_tuple(                                                                 \
+        JBRIDGE_INTERNAL_FOR_EACH(JBRIDGE_INTERNAL_STRUCT_FIELD, struct_name, __VA_ARGS__));                       \
+    static inline const bool preload_ = jb::detail::jni::RegisterPreload(                                           \
+        jb::traits::class_signature_v<mirror>.data(), #struct_name,                                                 \
+        &jb::detail::ResolveStructFields<struct_name>);                                                             \
+};
+
+// ============================================================================
+// Macros - Field Definition
+// ============================================================================
+
+#define JBRIDGE_DEFINE_FIELD(field_type, name)                                                                      \
+static auto name ## _field_() -> jb::detail::Field<false, jb::traits::array_wrapper_t<field_type>>& {               \
+    static auto field ## _ = jb::detail::CreateField<false, jb::traits::array_wrapper_t<field_type>>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return field ## _;                                                                                              \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(name, name, name ## _field_)                                                               \
+[[nodiscard]] decltype(auto) name() {                                                                               \
+    return name ## _field_().Update(object_.Get());                                                                 \
+}
+
+#define JBRIDGE_DEFINE_STATIC_FIELD(field_type, name)                                                               \
+static auto name ## _field_() -> jb::detail::Field<true, jb::traits::array_wrapper_t<field_type>>& {                \
+    static auto field ## _ = jb::detail::CreateField<true, jb::traits::array_wrapper_t<field_type>>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return field ## _;                                                                                              \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(name, name, name ## _field_)                                                               \
+[[nodiscard]] static decltype(auto) name() {                                                                        \
+    return name ## _field_().Update(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>());                           \
+}
+
+// static final fields: read once on first access, then served from a function-local static
+#define JBRIDGE_DEFINE_CONSTANT(field_type, name)                                                                   \
+static auto name ## _field_() -> jb::detail::Field<true, jb::traits::array_wrapper_t<field_type>>& {                \
+    static auto field ## _ = jb::detail::CreateField<true, jb::traits::array_wrapper_t<field_type>>(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>(), #name); \
+    return field ## _;                                                                                              \
+}                                                                                                                   \
+JBRIDGE_INTERNAL_PRELOAD(name, name, name ## _field_)                                                               \
+[[nodiscard]] static auto name() -> jb::traits::array_wrapper_t<field_type> {                                       \
+    static const auto value ## _ = jb::detail::MakeConstant(                                                        \
+        name ## _field_().Update(jb::detail::jni::FindCachedClass<CLASS_SIGNATURE>()).Get());                       \
+    return value ## _;                                                                                              \
 }
 
 #endif //JBRIDGE_JBRIDGE_HPP